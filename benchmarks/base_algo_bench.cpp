@@ -0,0 +1,329 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+#include "base_algo_let.h"
+
+namespace
+{
+std::vector<int> make_numbers(size_t size)
+{
+	std::mt19937 rng(1);
+	std::vector<int> v(size);
+	for (int& x : v)
+	{
+		// Ни одного кратного 10, чтобы поиск проходил массив целиком
+		x = static_cast<int>(rng()) | 1;
+		x -= x % 5 == 0 ? 2 : 0;
+	}
+	return v;
+}
+
+constexpr int64_t size = 1 << 24;
+}  // namespace
+
+template <typename Policy>
+static void BM_PositiveNumbers(benchmark::State& state, Policy policy)
+{
+	std::vector<int> v = make_numbers(size);
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(positive_numbers(policy, v).data());
+	}
+	state.SetItemsProcessed(state.iterations() * size);
+}
+BENCHMARK_CAPTURE(BM_PositiveNumbers, seq, std::execution::seq);
+BENCHMARK_CAPTURE(BM_PositiveNumbers, unseq, std::execution::unseq);
+BENCHMARK_CAPTURE(BM_PositiveNumbers, par, std::execution::par)->UseRealTime();
+
+template <typename Policy>
+static void BM_SumPositiveNumbers(benchmark::State& state, Policy policy)
+{
+	std::vector<int> v = make_numbers(size);
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(sum_positive_numbers(policy, v));
+	}
+	state.SetItemsProcessed(state.iterations() * size);
+}
+BENCHMARK_CAPTURE(BM_SumPositiveNumbers, seq, std::execution::seq);
+BENCHMARK_CAPTURE(BM_SumPositiveNumbers, unseq, std::execution::unseq);
+BENCHMARK_CAPTURE(BM_SumPositiveNumbers, par, std::execution::par)
+	->UseRealTime();
+
+template <typename Policy>
+static void BM_IsDivisibleBy10(benchmark::State& state, Policy policy)
+{
+	std::vector<int> v = make_numbers(size);
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(is_divisible_by_10(policy, v));
+	}
+	state.SetItemsProcessed(state.iterations() * size);
+}
+BENCHMARK_CAPTURE(BM_IsDivisibleBy10, seq, std::execution::seq);
+BENCHMARK_CAPTURE(BM_IsDivisibleBy10, unseq, std::execution::unseq);
+BENCHMARK_CAPTURE(BM_IsDivisibleBy10, par, std::execution::par)->UseRealTime();
+
+template <typename Policy>
+static void BM_ReplaceAndDouble(benchmark::State& state, Policy policy)
+{
+	std::vector<int> v = make_numbers(size);
+	for (auto _ : state)
+	{
+		replace_negative_numbers(policy, v);
+		double_values(policy, v);
+		benchmark::DoNotOptimize(v.data());
+	}
+	state.SetItemsProcessed(state.iterations() * size);
+}
+BENCHMARK_CAPTURE(BM_ReplaceAndDouble, seq, std::execution::seq);
+BENCHMARK_CAPTURE(BM_ReplaceAndDouble, par, std::execution::par)->UseRealTime();
+
+static void BM_PipelineSeparate(benchmark::State& state)
+{
+	std::vector<int> source = make_numbers(size);
+	for (auto _ : state)
+	{
+		state.PauseTiming();
+		std::vector<int> v = source;
+		state.ResumeTiming();
+		replace_negative_numbers(v);
+		double_values(v);
+		benchmark::DoNotOptimize(positive_numbers(v).data());
+		benchmark::DoNotOptimize(sum_positive_numbers(v));
+	}
+	state.SetItemsProcessed(state.iterations() * size);
+}
+BENCHMARK(BM_PipelineSeparate);
+
+static void BM_PipelineFused(benchmark::State& state)
+{
+	std::vector<int> source = make_numbers(size);
+	fused_pipeline pipeline;
+	pipeline.replace_negative().double_values().positives().sum();
+	for (auto _ : state)
+	{
+		state.PauseTiming();
+		std::vector<int> v = source;
+		state.ResumeTiming();
+		benchmark::DoNotOptimize(pipeline.run(v).positives.data());
+	}
+	state.SetItemsProcessed(state.iterations() * size);
+}
+BENCHMARK(BM_PipelineFused);
+
+namespace
+{
+enum distribution
+{
+	uniform,
+	skewed,
+	sorted
+};
+
+std::vector<int> make_sort_input(size_t count, int64_t kind)
+{
+	std::mt19937 rng(3);
+	std::vector<int> v(count);
+	for (int& x : v)
+	{
+		x = static_cast<int>(rng() >> 1);
+		if (kind == skewed)
+		{
+			// Большинство значений малы: старшие разряды почти всегда нули
+			x >>= 8 + rng() % 20;
+		}
+	}
+	if (kind == sorted)
+	{
+		std::sort(v.begin(), v.end());
+	}
+	return v;
+}
+}  // namespace
+
+template <typename Policy>
+static void BM_SortPositive(benchmark::State& state, Policy policy)
+{
+	std::vector<int> source = make_sort_input(
+		static_cast<size_t>(state.range(1)), state.range(0));
+	std::vector<int> v;
+	for (auto _ : state)
+	{
+		state.PauseTiming();
+		v = source;
+		state.ResumeTiming();
+		sort_positive_numbers(policy, v, sort_order::descending);
+		benchmark::DoNotOptimize(v.data());
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(1));
+}
+#define SORT_ARGS                                                     \
+	ArgNames({"dist", "n"})                                           \
+		->ArgsProduct({{uniform, skewed, sorted}, {1 << 10, 1 << 12, 1 << 22}})
+BENCHMARK_CAPTURE(BM_SortPositive, seq, std::execution::seq)->SORT_ARGS;
+BENCHMARK_CAPTURE(BM_SortPositive, unseq, std::execution::unseq)->SORT_ARGS;
+BENCHMARK_CAPTURE(BM_SortPositive, par, std::execution::par)
+	->SORT_ARGS->UseRealTime();
+
+namespace
+{
+/// Имена с общими префиксами длиннее 8 байт, как фамилии с инициалами
+std::vector<Student> make_students(size_t count)
+{
+	static const char* surnames[] = {"Ivanov",	 "Petrov",	 "Smirnov",
+									 "Kuznetsov", "Popov",	 "Vasilyev",
+									 "Sokolov",	 "Mikhailov"};
+	std::mt19937 rng(11);
+	std::vector<Student> students;
+	students.reserve(count);
+	for (size_t i = 0; i < count; ++i)
+	{
+		std::string name = surnames[rng() % 8];
+		name += ' ';
+		name += static_cast<char>('A' + rng() % 26);
+		name += std::to_string(rng() % 100000);
+		students.emplace_back(name.c_str(), static_cast<int>(rng() % 60 + 16));
+	}
+	return students;
+}
+
+constexpr size_t student_count = 1 << 20;
+}  // namespace
+
+static void BM_StdSortStudentsByName(benchmark::State& state)
+{
+	std::vector<Student> source = make_students(student_count);
+	for (auto _ : state)
+	{
+		state.PauseTiming();
+		std::vector<Student> v = source;
+		state.ResumeTiming();
+		std::stable_sort(v.begin(), v.end(),
+						 [](const Student& a, const Student& b)
+						 { return a.name < b.name; });
+		benchmark::DoNotOptimize(v.data());
+	}
+	state.SetItemsProcessed(state.iterations() * student_count);
+}
+BENCHMARK(BM_StdSortStudentsByName);
+
+static void BM_SortStudentsByName(benchmark::State& state)
+{
+	std::vector<Student> source = make_students(student_count);
+	for (auto _ : state)
+	{
+		state.PauseTiming();
+		std::vector<Student> v = source;
+		state.ResumeTiming();
+		sort_students_by_name(v);
+		benchmark::DoNotOptimize(v.data());
+	}
+	state.SetItemsProcessed(state.iterations() * student_count);
+}
+BENCHMARK(BM_SortStudentsByName);
+
+static void BM_StdSortStudentsByAge(benchmark::State& state)
+{
+	std::vector<Student> source = make_students(student_count);
+	for (auto _ : state)
+	{
+		state.PauseTiming();
+		std::vector<Student> v = source;
+		state.ResumeTiming();
+		std::stable_sort(v.begin(), v.end(),
+						 [](const Student& a, const Student& b)
+						 { return a.age < b.age; });
+		benchmark::DoNotOptimize(v.data());
+	}
+	state.SetItemsProcessed(state.iterations() * student_count);
+}
+BENCHMARK(BM_StdSortStudentsByAge);
+
+static void BM_SortStudentsByAge(benchmark::State& state)
+{
+	std::vector<Student> source = make_students(student_count);
+	for (auto _ : state)
+	{
+		state.PauseTiming();
+		std::vector<Student> v = source;
+		state.ResumeTiming();
+		sort_students_by_age(v);
+		benchmark::DoNotOptimize(v.data());
+	}
+	state.SetItemsProcessed(state.iterations() * student_count);
+}
+BENCHMARK(BM_SortStudentsByAge);
+
+static void BM_StudentTableSortByName(benchmark::State& state)
+{
+	StudentTable source(make_students(student_count));
+	for (auto _ : state)
+	{
+		state.PauseTiming();
+		StudentTable table = source;
+		state.ResumeTiming();
+		table.sort_by_name();
+		benchmark::DoNotOptimize(&table);
+	}
+	state.SetItemsProcessed(state.iterations() * student_count);
+}
+BENCHMARK(BM_StudentTableSortByName);
+
+/// Масштабирование по числу потоков пула: Arg - размер пула
+static void BM_StdStableSortStudentsMultiKey(benchmark::State& state)
+{
+	std::vector<Student> source = make_students(student_count);
+	for (auto _ : state)
+	{
+		state.PauseTiming();
+		std::vector<Student> v = source;
+		state.ResumeTiming();
+		std::stable_sort(v.begin(), v.end(),
+						 [](const Student& a, const Student& b)
+						 {
+							 return a.name != b.name ? a.name < b.name
+													 : a.age < b.age;
+						 });
+		benchmark::DoNotOptimize(v.data());
+	}
+	state.SetItemsProcessed(state.iterations() * student_count);
+}
+BENCHMARK(BM_StdStableSortStudentsMultiKey);
+
+static void BM_ParallelSortStudents(benchmark::State& state)
+{
+	std::vector<Student> source = make_students(student_count);
+	bmstu::thread_pool pool(static_cast<size_t>(state.range(0)));
+	for (auto _ : state)
+	{
+		state.PauseTiming();
+		std::vector<Student> v = source;
+		state.ResumeTiming();
+		sort_students(pool, v, by_name, then_by_age);
+		benchmark::DoNotOptimize(v.data());
+	}
+	state.SetItemsProcessed(state.iterations() * student_count);
+}
+BENCHMARK(BM_ParallelSortStudents)->RangeMultiplier(2)->Range(1, 64)
+	->UseRealTime();
+
+static void BM_PartialSortStudents(benchmark::State& state)
+{
+	std::vector<Student> source = make_students(student_count);
+	bmstu::thread_pool pool(static_cast<size_t>(state.range(0)));
+	for (auto _ : state)
+	{
+		state.PauseTiming();
+		std::vector<Student> v = source;
+		state.ResumeTiming();
+		partial_sort_students(pool, v, 100, by_name, then_by_age);
+		benchmark::DoNotOptimize(v.data());
+	}
+	state.SetItemsProcessed(state.iterations() * student_count);
+}
+BENCHMARK(BM_PartialSortStudents)->RangeMultiplier(2)->Range(1, 64)
+	->UseRealTime();
@@ -0,0 +1,95 @@
+#include <benchmark/benchmark.h>
+
+#include <iterator>
+#include <list>
+#include "bmstu_list.h"
+
+template <typename List>
+static void BM_ListPushBack(benchmark::State& state)
+{
+	int count = static_cast<int>(state.range(0));
+	for (auto _ : state)
+	{
+		List l;
+		for (int i = 0; i < count; ++i)
+		{
+			l.push_back(i);
+		}
+		benchmark::DoNotOptimize(l.size());
+	}
+	state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK_TEMPLATE(BM_ListPushBack, std::list<int>)->Arg(1 << 10)->Arg(1 << 18);
+BENCHMARK_TEMPLATE(BM_ListPushBack, bmstu::list<int>)
+	->Arg(1 << 10)
+	->Arg(1 << 18);
+
+template <typename List>
+static void BM_ListPushFront(benchmark::State& state)
+{
+	int count = static_cast<int>(state.range(0));
+	for (auto _ : state)
+	{
+		List l;
+		for (int i = 0; i < count; ++i)
+		{
+			l.push_front(i);
+		}
+		benchmark::DoNotOptimize(l.size());
+	}
+	state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK_TEMPLATE(BM_ListPushFront, std::list<int>)->Arg(1 << 10);
+BENCHMARK_TEMPLATE(BM_ListPushFront, bmstu::list<int>)->Arg(1 << 10);
+
+template <typename List>
+static void BM_ListIterate(benchmark::State& state)
+{
+	int count = static_cast<int>(state.range(0));
+	List l;
+	for (int i = 0; i < count; ++i)
+	{
+		l.push_back(i);
+	}
+	for (auto _ : state)
+	{
+		int64_t sum = 0;
+		for (auto it = l.begin(); it != l.end(); ++it)
+		{
+			sum += *it;
+		}
+		benchmark::DoNotOptimize(sum);
+	}
+	state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK_TEMPLATE(BM_ListIterate, std::list<int>)->Arg(1 << 10)->Arg(1 << 18);
+BENCHMARK_TEMPLATE(BM_ListIterate, bmstu::list<int>)
+	->Arg(1 << 10)
+	->Arg(1 << 18);
+
+/// Вставка перед каждым вторым элементом за один проход
+template <typename List>
+static void BM_ListInsert(benchmark::State& state)
+{
+	int count = static_cast<int>(state.range(0));
+	List source;
+	for (int i = 0; i < count; ++i)
+	{
+		source.push_back(i);
+	}
+	for (auto _ : state)
+	{
+		state.PauseTiming();
+		List l(source);
+		state.ResumeTiming();
+		for (auto it = l.begin(); it != l.end(); ++it)
+		{
+			it = l.insert(it, -1);
+			++it;
+		}
+		benchmark::DoNotOptimize(l.size());
+	}
+	state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK_TEMPLATE(BM_ListInsert, std::list<int>)->Arg(1 << 12);
+BENCHMARK_TEMPLATE(BM_ListInsert, bmstu::list<int>)->Arg(1 << 12);
@@ -0,0 +1,148 @@
+#include <benchmark/benchmark.h>
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+#include "bmstu_channel.h"
+
+/// Конвейер из stages стадий, каждая передает значение дальше: корутины на
+/// одном потоке против потока на стадию с блокирующей очередью на
+/// bmstu::list, как раньше
+namespace
+{
+constexpr int values = 1000;
+
+bmstu::task forward(bmstu::channel<int>& in, bmstu::channel<int>& out)
+{
+	while (std::optional<int> value = co_await in.recv())
+	{
+		co_await out.send(*value + 1);
+	}
+	out.close();
+}
+
+bmstu::task produce(bmstu::channel<int>& out)
+{
+	for (int i = 0; i < values; ++i)
+	{
+		co_await out.send(i);
+	}
+	out.close();
+}
+
+bmstu::task drain(bmstu::channel<int>& in, int64_t& sum)
+{
+	while (std::optional<int> value = co_await in.recv())
+	{
+		sum += *value;
+	}
+}
+
+/// Очередь с ожиданием на условной переменной; -1 - конец потока
+class blocking_queue
+{
+   public:
+	explicit blocking_queue(size_t capacity) : capacity_(capacity) {}
+
+	void push(int value)
+	{
+		std::unique_lock lock(mutex_);
+		not_full_.wait(lock, [this] { return items_.size() < capacity_; });
+		items_.push_back(value);
+		not_empty_.notify_one();
+	}
+
+	int pop()
+	{
+		std::unique_lock lock(mutex_);
+		not_empty_.wait(lock, [this] { return !items_.empty(); });
+		int value = items_.front();
+		items_.pop_front();
+		not_full_.notify_one();
+		return value;
+	}
+
+   private:
+	size_t capacity_;
+	std::mutex mutex_;
+	std::condition_variable not_full_;
+	std::condition_variable not_empty_;
+	bmstu::list<int> items_;
+};
+}  // namespace
+
+static void BM_CoroutinePipeline(benchmark::State& state)
+{
+	size_t stages = static_cast<size_t>(state.range(0));
+	for (auto _ : state)
+	{
+		bmstu::single_thread_executor executor;
+		std::vector<std::unique_ptr<bmstu::channel<int>>> channels;
+		for (size_t i = 0; i <= stages; ++i)
+		{
+			channels.push_back(std::make_unique<bmstu::channel<int>>(16));
+		}
+		for (size_t i = 0; i < stages; ++i)
+		{
+			bmstu::spawn(executor, forward(*channels[i], *channels[i + 1]));
+		}
+		int64_t sum = 0;
+		bmstu::spawn(executor, drain(*channels[stages], sum));
+		bmstu::spawn(executor, produce(*channels[0]));
+		executor.run();
+		benchmark::DoNotOptimize(sum);
+	}
+	state.SetItemsProcessed(state.iterations() * values * state.range(0));
+}
+BENCHMARK(BM_CoroutinePipeline)->Arg(16)->Arg(1000)->UseRealTime();
+
+static void BM_ThreadPipeline(benchmark::State& state)
+{
+	size_t stages = static_cast<size_t>(state.range(0));
+	for (auto _ : state)
+	{
+		std::vector<std::unique_ptr<blocking_queue>> queues;
+		for (size_t i = 0; i <= stages; ++i)
+		{
+			queues.push_back(std::make_unique<blocking_queue>(16));
+		}
+		std::vector<std::thread> threads;
+		for (size_t i = 0; i < stages; ++i)
+		{
+			threads.emplace_back(
+				[&, i]
+				{
+					int value = 0;
+					while ((value = queues[i]->pop()) != -1)
+					{
+						queues[i + 1]->push(value + 1);
+					}
+					queues[i + 1]->push(-1);
+				});
+		}
+		threads.emplace_back(
+			[&]
+			{
+				for (int i = 0; i < values; ++i)
+				{
+					queues[0]->push(i);
+				}
+				queues[0]->push(-1);
+			});
+		int64_t sum = 0;
+		for (int value = 0; (value = queues[stages]->pop()) != -1;)
+		{
+			sum += value;
+		}
+		for (std::thread& thread : threads)
+		{
+			thread.join();
+		}
+		benchmark::DoNotOptimize(sum);
+	}
+	state.SetItemsProcessed(state.iterations() * values * state.range(0));
+}
+BENCHMARK(BM_ThreadPipeline)->Arg(16)->UseRealTime();
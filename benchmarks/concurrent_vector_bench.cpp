@@ -0,0 +1,70 @@
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "concurrent_vector.h"
+
+/// Все потоки бенчмарка добавляют в один общий контейнер. Поток 0 создает
+/// его до цикла и удаляет после: цикл начинается и заканчивается барьером
+namespace
+{
+struct locked_vector
+{
+	void push_back(int value)
+	{
+		std::lock_guard lock(mutex);
+		items.push_back(value);
+	}
+
+	std::mutex mutex;
+	bmstu::simple_vector<int> items;
+};
+
+template <typename Shared>
+Shared* shared_instance = nullptr;
+}  // namespace
+
+template <typename Shared>
+static void BM_ContendedPushBack(benchmark::State& state)
+{
+	if (state.thread_index() == 0)
+	{
+		shared_instance<Shared> = new Shared;
+	}
+	for (auto _ : state)
+	{
+		shared_instance<Shared>->push_back(state.thread_index());
+	}
+	if (state.thread_index() == 0)
+	{
+		delete shared_instance<Shared>;
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_TEMPLATE(BM_ContendedPushBack, bmstu::concurrent_vector<int>)
+	->ThreadRange(1, 16)
+	->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ContendedPushBack, locked_vector)
+	->ThreadRange(1, 16)
+	->UseRealTime();
+
+/// grow_by занимает место под пачку одной атомарной операцией
+static void BM_ContendedGrowBy(benchmark::State& state)
+{
+	using vector = bmstu::concurrent_vector<int>;
+	if (state.thread_index() == 0)
+	{
+		shared_instance<vector> = new vector;
+	}
+	for (auto _ : state)
+	{
+		shared_instance<vector>->grow_by(64, state.thread_index());
+	}
+	if (state.thread_index() == 0)
+	{
+		delete shared_instance<vector>;
+	}
+	state.SetItemsProcessed(state.iterations() * 64);
+}
+BENCHMARK(BM_ContendedGrowBy)->ThreadRange(1, 16)->UseRealTime();
@@ -0,0 +1,60 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+#include "bmstu_simple_vector.h"
+#include "bmstu_string.h"
+
+namespace
+{
+std::string make_text(size_t size)
+{
+	std::string text(size, ' ');
+	for (size_t i = 0; i < size; ++i)
+	{
+		text[i] = static_cast<char>('a' + (i * 7) % 26);
+	}
+	return text;
+}
+}  // namespace
+
+static void BM_StdHashString(benchmark::State& state)
+{
+	std::string text = make_text(static_cast<size_t>(state.range(0)));
+	std::hash<std::string> hasher;
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(hasher(text));
+	}
+	state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_StdHashString)->RangeMultiplier(4)->Range(8, 64 << 10);
+
+static void BM_BmstuHashString(benchmark::State& state)
+{
+	bmstu::string text(make_text(static_cast<size_t>(state.range(0))).c_str());
+	std::hash<bmstu::string> hasher;
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(hasher(text));
+	}
+	state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_BmstuHashString)->RangeMultiplier(4)->Range(8, 64 << 10);
+
+static void BM_BmstuHashSimpleVector(benchmark::State& state)
+{
+	bmstu::simple_vector<int> vec(static_cast<size_t>(state.range(0)));
+	for (size_t i = 0; i < vec.size(); ++i)
+	{
+		vec[i] = static_cast<int>(i);
+	}
+	std::hash<bmstu::simple_vector<int>> hasher;
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(hasher(vec));
+	}
+	state.SetBytesProcessed(state.iterations() * state.range(0) *
+							static_cast<int64_t>(sizeof(int)));
+}
+BENCHMARK(BM_BmstuHashSimpleVector)->RangeMultiplier(4)->Range(8, 16 << 10);
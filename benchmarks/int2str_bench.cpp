@@ -0,0 +1,219 @@
+#include <benchmark/benchmark.h>
+
+#include <charconv>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <thread>
+#include <vector>
+#include "int2str.h"
+#include "string_builder.h"
+
+namespace
+{
+/// Числа со случайной длиной записи, чтобы не подыгрывать предсказателю
+std::vector<int64_t> make_numbers(bool wide)
+{
+	std::mt19937_64 rng(42);
+	std::vector<int64_t> numbers(4096);
+	for (int64_t& n : numbers)
+	{
+		int digits = static_cast<int>(rng() % (wide ? 19 : 10)) + 1;
+		int64_t limit = 1;
+		for (int i = 0; i < digits; ++i)
+		{
+			limit *= 10;
+		}
+		n = static_cast<int64_t>(rng() % static_cast<uint64_t>(limit));
+		if (rng() & 1)
+		{
+			n = -n;
+		}
+	}
+	if (!wide)
+	{
+		for (int64_t& n : numbers)
+		{
+			n = static_cast<int32_t>(n);
+		}
+	}
+	return numbers;
+}
+}  // namespace
+
+static void BM_Snprintf(benchmark::State& state)
+{
+	auto numbers = make_numbers(false);
+	char buf[32];
+	for (auto _ : state)
+	{
+		for (int64_t n : numbers)
+		{
+			benchmark::DoNotOptimize(
+				std::snprintf(buf, sizeof(buf), "%d", static_cast<int>(n)));
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * numbers.size());
+}
+BENCHMARK(BM_Snprintf);
+
+static void BM_ToChars(benchmark::State& state)
+{
+	auto numbers = make_numbers(false);
+	char buf[32];
+	for (auto _ : state)
+	{
+		for (int64_t n : numbers)
+		{
+			benchmark::DoNotOptimize(
+				std::to_chars(buf, buf + sizeof(buf), static_cast<int>(n)).ptr);
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * numbers.size());
+}
+BENCHMARK(BM_ToChars);
+
+static void BM_Int2StrR(benchmark::State& state)
+{
+	auto numbers = make_numbers(false);
+	char buf[32];
+	for (auto _ : state)
+	{
+		for (int64_t n : numbers)
+		{
+			benchmark::DoNotOptimize(
+				int2str_r(static_cast<int>(n), buf, sizeof(buf)));
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * numbers.size());
+}
+BENCHMARK(BM_Int2StrR);
+
+static void BM_ToChars64(benchmark::State& state)
+{
+	auto numbers = make_numbers(true);
+	char buf[32];
+	for (auto _ : state)
+	{
+		for (int64_t n : numbers)
+		{
+			benchmark::DoNotOptimize(
+				std::to_chars(buf, buf + sizeof(buf), n).ptr);
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * numbers.size());
+}
+BENCHMARK(BM_ToChars64);
+
+static void BM_Int64ToStrR(benchmark::State& state)
+{
+	auto numbers = make_numbers(true);
+	char buf[32];
+	for (auto _ : state)
+	{
+		for (int64_t n : numbers)
+		{
+			benchmark::DoNotOptimize(int64_2str_r(n, buf, sizeof(buf)));
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * numbers.size());
+}
+BENCHMARK(BM_Int64ToStrR);
+
+/// string_builder::append для целых (std::to_chars) против int64_2str_r с
+/// добавлением готовых символов
+static void BM_BuilderAppendToChars(benchmark::State& state)
+{
+	auto numbers = make_numbers(true);
+	bmstu::string_builder<char> builder;
+	for (auto _ : state)
+	{
+		for (int64_t n : numbers)
+		{
+			builder.append(n);
+		}
+		benchmark::DoNotOptimize(builder.size());
+		builder.clear();
+	}
+	state.SetItemsProcessed(state.iterations() * numbers.size());
+}
+BENCHMARK(BM_BuilderAppendToChars);
+
+static void BM_BuilderAppendInt64ToStrR(benchmark::State& state)
+{
+	auto numbers = make_numbers(true);
+	bmstu::string_builder<char> builder;
+	char buf[32];
+	for (auto _ : state)
+	{
+		for (int64_t n : numbers)
+		{
+			builder.append(buf, int64_2str_r(n, buf, sizeof(buf)));
+		}
+		benchmark::DoNotOptimize(builder.size());
+		builder.clear();
+	}
+	state.SetItemsProcessed(state.iterations() * numbers.size());
+}
+BENCHMARK(BM_BuilderAppendInt64ToStrR);
+
+static std::vector<int> make_column(size_t count)
+{
+	auto numbers = make_numbers(false);
+	std::vector<int> column(count);
+	for (size_t i = 0; i < count; ++i)
+	{
+		column[i] = static_cast<int>(numbers[i % numbers.size()]);
+	}
+	return column;
+}
+
+static void BM_ArrayPerElement(benchmark::State& state)
+{
+	auto column = make_column(static_cast<size_t>(state.range(0)));
+	std::vector<char> out(column.size() * 12 + 1);
+	for (auto _ : state)
+	{
+		char* p = out.data();
+		for (int n : column)
+		{
+			char buf[12];
+			size_t len = int2str_r(n, buf, sizeof(buf));
+			std::memcpy(p, buf, len);
+			p += len;
+			*p++ = ',';
+		}
+		benchmark::DoNotOptimize(p);
+	}
+	state.SetItemsProcessed(state.iterations() * column.size());
+}
+BENCHMARK(BM_ArrayPerElement)->Arg(1 << 20);
+
+static void BM_Array(benchmark::State& state)
+{
+	auto column = make_column(static_cast<size_t>(state.range(0)));
+	std::vector<char> out(column.size() * 12 + 1);
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(int2str_array(column.data(), column.size(),
+											   ',', out.data(), out.size()));
+	}
+	state.SetItemsProcessed(state.iterations() * column.size());
+}
+BENCHMARK(BM_Array)->Arg(1 << 20);
+
+static void BM_ArrayMt(benchmark::State& state)
+{
+	auto column = make_column(static_cast<size_t>(state.range(0)));
+	std::vector<char> out(column.size() * 12 + 1);
+	unsigned threads = std::thread::hardware_concurrency();
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(int2str_array_mt(column.data(), column.size(),
+												  ',', out.data(), out.size(),
+												  threads));
+	}
+	state.SetItemsProcessed(state.iterations() * column.size());
+}
+BENCHMARK(BM_ArrayMt)->Arg(1 << 20)->UseRealTime();
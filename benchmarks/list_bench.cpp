@@ -0,0 +1,92 @@
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <numeric>
+#include <vector>
+#include "base_node_let.h"
+
+namespace
+{
+std::vector<int> make_values(size_t size)
+{
+	std::vector<int> v(size);
+	std::iota(v.begin(), v.end(), 0);
+	return v;
+}
+
+int64_t sum_list(const ForwardListNode<int>* head)
+{
+	int64_t sum = 0;
+	for (; head != nullptr; head = head->next)
+	{
+		sum += head->data;
+	}
+	return sum;
+}
+}  // namespace
+
+static void BM_ListTraverseHeap(benchmark::State& state)
+{
+	std::vector<int> values = make_values(static_cast<size_t>(state.range(0)));
+	// Узлы вперемешку с чужими аллокациями, как в долгоживущей программе
+	std::vector<std::unique_ptr<int>> noise;
+	ForwardListNode<int>* head = nullptr;
+	ForwardListNode<int>** tail = &head;
+	for (int value : values)
+	{
+		noise.push_back(std::make_unique<int>(value));
+		*tail = new ForwardListNode<int>(value);
+		tail = &(*tail)->next;
+	}
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(sum_list(head));
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+	delete_list(head);
+}
+BENCHMARK(BM_ListTraverseHeap)->Arg(1 << 10)->Arg(1 << 20);
+
+static void BM_ListTraverseArena(benchmark::State& state)
+{
+	std::vector<int> values = make_values(static_cast<size_t>(state.range(0)));
+	ForwardListArena<int> arena;
+	ForwardListNode<int>* head = nullptr;
+	create_list(head, values, arena);
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(sum_list(head));
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+	delete_list(head, arena);
+}
+BENCHMARK(BM_ListTraverseArena)->Arg(1 << 10)->Arg(1 << 20);
+
+static void BM_ListCreateDeleteHeap(benchmark::State& state)
+{
+	std::vector<int> values = make_values(static_cast<size_t>(state.range(0)));
+	for (auto _ : state)
+	{
+		ForwardListNode<int>* head = nullptr;
+		create_list(head, values);
+		benchmark::DoNotOptimize(head);
+		delete_list(head);
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ListCreateDeleteHeap)->Arg(1 << 10)->Arg(1 << 20);
+
+static void BM_ListCreateDeleteArena(benchmark::State& state)
+{
+	std::vector<int> values = make_values(static_cast<size_t>(state.range(0)));
+	ForwardListArena<int> arena;
+	for (auto _ : state)
+	{
+		ForwardListNode<int>* head = nullptr;
+		create_list(head, values, arena);
+		benchmark::DoNotOptimize(head);
+		delete_list(head, arena);
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ListCreateDeleteArena)->Arg(1 << 10)->Arg(1 << 20);
@@ -0,0 +1,81 @@
+#include <benchmark/benchmark.h>
+
+#include <spanstream>
+#include <vector>
+#include "bmstu_list.h"
+#include "bmstu_simple_vector.h"
+
+/// operator<< контейнеров против прежней печати по элементу в тот же поток
+namespace
+{
+template <typename Container>
+Container sample_numbers(size_t size)
+{
+	Container c;
+	for (size_t i = 0; i < size; ++i)
+	{
+		c.push_back(static_cast<int>(i * 2654435761u));
+	}
+	return c;
+}
+}  // namespace
+
+template <typename Container>
+static void BM_PrintPerElement(benchmark::State& state)
+{
+	size_t size = static_cast<size_t>(state.range(0));
+	Container c = sample_numbers<Container>(size);
+	std::vector<char> buffer(size * 16 + 16);
+	for (auto _ : state)
+	{
+		std::ospanstream os(buffer);
+		for (int value : c)
+		{
+			os << value << ' ';
+		}
+		benchmark::DoNotOptimize(buffer.data());
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_PrintPerElement, bmstu::simple_vector<int>)
+	->Arg(1 << 10)
+	->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_PrintPerElement, bmstu::list<int>)->Arg(1 << 10);
+
+template <typename Container>
+static void BM_PrintBuffered(benchmark::State& state)
+{
+	size_t size = static_cast<size_t>(state.range(0));
+	Container c = sample_numbers<Container>(size);
+	std::vector<char> buffer(size * 16 + 16);
+	for (auto _ : state)
+	{
+		std::ospanstream os(buffer);
+		os << c;
+		benchmark::DoNotOptimize(buffer.data());
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_PrintBuffered, bmstu::simple_vector<int>)
+	->Arg(1 << 10)
+	->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_PrintBuffered, bmstu::list<int>)->Arg(1 << 10);
+
+static void BM_PrintDoubles(benchmark::State& state)
+{
+	size_t size = static_cast<size_t>(state.range(0));
+	bmstu::simple_vector<double> v;
+	for (size_t i = 0; i < size; ++i)
+	{
+		v.push_back(static_cast<double>(i) / 7);
+	}
+	std::vector<char> buffer(size * 24 + 16);
+	for (auto _ : state)
+	{
+		std::ospanstream os(buffer);
+		os << v;
+		benchmark::DoNotOptimize(buffer.data());
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_PrintDoubles)->Arg(1 << 10);
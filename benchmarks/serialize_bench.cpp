@@ -0,0 +1,126 @@
+#include <benchmark/benchmark.h>
+
+#include <spanstream>
+#include <vector>
+#include "bmstu_serialize.h"
+
+/// Запись и чтение идут в заранее выделенный буфер через spanstream, чтобы
+/// мерить формат, а не рост строки в stringstream
+namespace
+{
+bmstu::simple_vector<int> sample_vector(size_t size)
+{
+	bmstu::simple_vector<int> v;
+	v.reserve(size);
+	for (size_t i = 0; i < size; ++i)
+	{
+		v.push_back(static_cast<int>(i * 2654435761u));
+	}
+	return v;
+}
+
+template <typename C>
+std::vector<char> serialized(const C& container, size_t capacity)
+{
+	std::vector<char> buffer(capacity);
+	std::ospanstream os(buffer);
+	bmstu::serial::write(os, container);
+	buffer.resize(static_cast<size_t>(os.span().size()));
+	return buffer;
+}
+}  // namespace
+
+static void BM_SerializeVectorBinary(benchmark::State& state)
+{
+	size_t size = static_cast<size_t>(state.range(0));
+	bmstu::simple_vector<int> v = sample_vector(size);
+	std::vector<char> buffer(size * sizeof(int) + 64);
+	for (auto _ : state)
+	{
+		std::ospanstream os(buffer);
+		bmstu::serial::write(os, v);
+		benchmark::DoNotOptimize(buffer.data());
+	}
+	state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(int));
+}
+BENCHMARK(BM_SerializeVectorBinary)->Arg(1 << 10)->Arg(1 << 20);
+
+/// Прежний путь - текст через operator<<
+static void BM_SerializeVectorText(benchmark::State& state)
+{
+	size_t size = static_cast<size_t>(state.range(0));
+	bmstu::simple_vector<int> v = sample_vector(size);
+	std::vector<char> buffer(size * 16);
+	for (auto _ : state)
+	{
+		std::ospanstream os(buffer);
+		os << v;
+		benchmark::DoNotOptimize(buffer.data());
+	}
+	state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(int));
+}
+BENCHMARK(BM_SerializeVectorText)->Arg(1 << 10)->Arg(1 << 20);
+
+static void BM_DeserializeVector(benchmark::State& state)
+{
+	size_t size = static_cast<size_t>(state.range(0));
+	std::vector<char> buffer =
+		serialized(sample_vector(size), size * sizeof(int) + 64);
+	for (auto _ : state)
+	{
+		std::ispanstream is(buffer);
+		auto v = bmstu::serial::read<bmstu::simple_vector<int>>(is);
+		benchmark::DoNotOptimize(v.begin());
+	}
+	state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(int));
+}
+BENCHMARK(BM_DeserializeVector)->Arg(1 << 10)->Arg(1 << 20);
+
+static void BM_ViewVector(benchmark::State& state)
+{
+	size_t size = static_cast<size_t>(state.range(0));
+	std::vector<char> buffer =
+		serialized(sample_vector(size), size * sizeof(int) + 64);
+	for (auto _ : state)
+	{
+		auto view =
+			bmstu::serial::view_vector<int>(std::as_bytes(std::span(buffer)));
+		benchmark::DoNotOptimize(view.data());
+	}
+	state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(int));
+}
+BENCHMARK(BM_ViewVector)->Arg(1 << 20);
+
+static void BM_SerializeListBinary(benchmark::State& state)
+{
+	size_t size = static_cast<size_t>(state.range(0));
+	bmstu::list<int> l;
+	for (size_t i = 0; i < size; ++i)
+	{
+		l.push_back(static_cast<int>(i));
+	}
+	std::vector<char> buffer(size * sizeof(int) + 64);
+	for (auto _ : state)
+	{
+		std::ospanstream os(buffer);
+		bmstu::serial::write(os, l);
+		benchmark::DoNotOptimize(buffer.data());
+	}
+	state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(int));
+}
+BENCHMARK(BM_SerializeListBinary)->Arg(1 << 16);
+
+static void BM_DeserializeString(benchmark::State& state)
+{
+	size_t size = static_cast<size_t>(state.range(0));
+	bmstu::string str(size);
+	std::vector<char> buffer = serialized(str, size + 64);
+	for (auto _ : state)
+	{
+		std::ispanstream is(buffer);
+		auto back = bmstu::serial::read<bmstu::string>(is);
+		benchmark::DoNotOptimize(back.c_str());
+	}
+	state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_DeserializeString)->Arg(1 << 20);
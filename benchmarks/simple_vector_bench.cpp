@@ -0,0 +1,97 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+#include "bmstu_simple_vector.h"
+
+/// Каждый бенчмарк - шаблон по контейнеру, bmstu::simple_vector идет рядом
+/// с std::vector под тем же именем
+template <typename Vector>
+static void BM_VectorPushBack(benchmark::State& state)
+{
+	int count = static_cast<int>(state.range(0));
+	for (auto _ : state)
+	{
+		Vector v;
+		for (int i = 0; i < count; ++i)
+		{
+			v.push_back(i);
+		}
+		benchmark::DoNotOptimize(v.begin());
+	}
+	state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK_TEMPLATE(BM_VectorPushBack, std::vector<int>)
+	->Arg(1 << 10)
+	->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_VectorPushBack, bmstu::simple_vector<int>)
+	->Arg(1 << 10)
+	->Arg(1 << 20);
+
+template <typename Vector>
+static void BM_VectorInsertMiddle(benchmark::State& state)
+{
+	int count = static_cast<int>(state.range(0));
+	for (auto _ : state)
+	{
+		Vector v;
+		for (int i = 0; i < count; ++i)
+		{
+			v.insert(v.begin() + static_cast<std::ptrdiff_t>(v.size() / 2), i);
+		}
+		benchmark::DoNotOptimize(v.begin());
+	}
+	state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK_TEMPLATE(BM_VectorInsertMiddle, std::vector<int>)->Arg(1 << 12);
+BENCHMARK_TEMPLATE(BM_VectorInsertMiddle, bmstu::simple_vector<int>)
+	->Arg(1 << 12);
+
+template <typename Vector>
+static void BM_VectorEraseFront(benchmark::State& state)
+{
+	int count = static_cast<int>(state.range(0));
+	Vector source;
+	for (int i = 0; i < count; ++i)
+	{
+		source.push_back(i);
+	}
+	for (auto _ : state)
+	{
+		state.PauseTiming();
+		Vector v = source;
+		state.ResumeTiming();
+		while (v.size() != 0)
+		{
+			v.erase(v.begin());
+		}
+		benchmark::DoNotOptimize(v.begin());
+	}
+	state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK_TEMPLATE(BM_VectorEraseFront, std::vector<int>)->Arg(1 << 12);
+BENCHMARK_TEMPLATE(BM_VectorEraseFront, bmstu::simple_vector<int>)
+	->Arg(1 << 12);
+
+template <typename Vector>
+static void BM_VectorCopy(benchmark::State& state)
+{
+	int count = static_cast<int>(state.range(0));
+	Vector source;
+	for (int i = 0; i < count; ++i)
+	{
+		source.push_back(i);
+	}
+	for (auto _ : state)
+	{
+		Vector copy(source);
+		benchmark::DoNotOptimize(copy.begin());
+	}
+	state.SetBytesProcessed(state.iterations() * count *
+							static_cast<int64_t>(sizeof(int)));
+}
+BENCHMARK_TEMPLATE(BM_VectorCopy, std::vector<int>)
+	->Arg(1 << 10)
+	->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_VectorCopy, bmstu::simple_vector<int>)
+	->Arg(1 << 10)
+	->Arg(1 << 20);
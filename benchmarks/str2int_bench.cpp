@@ -0,0 +1,124 @@
+#include <benchmark/benchmark.h>
+
+#include <charconv>
+#include <cstdint>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+#include "str2int.h"
+
+namespace
+{
+/// Колонка чисел случайной длины через '\n', как в CSV
+std::string make_column(bool wide, size_t count)
+{
+	std::mt19937_64 rng(7);
+	std::string text;
+	for (size_t i = 0; i < count; ++i)
+	{
+		int64_t n = static_cast<int64_t>(rng() >> (rng() % 64));
+		if (!wide)
+		{
+			n = static_cast<int32_t>(n);
+		}
+		text += std::to_string(n);
+		text += '\n';
+	}
+	return text;
+}
+
+constexpr size_t count = 4096;
+}  // namespace
+
+static void BM_Strtol(benchmark::State& state)
+{
+	std::string text = make_column(false, count);
+	std::vector<int> values(count);
+	for (auto _ : state)
+	{
+		const char* p = text.c_str();
+		for (size_t i = 0; i < count; ++i)
+		{
+			char* end;
+			values[i] = static_cast<int>(std::strtol(p, &end, 10));
+			p = end + 1;
+		}
+		benchmark::DoNotOptimize(values.data());
+	}
+	state.SetBytesProcessed(state.iterations() * text.size());
+}
+BENCHMARK(BM_Strtol);
+
+static void BM_FromChars(benchmark::State& state)
+{
+	std::string text = make_column(false, count);
+	std::vector<int> values(count);
+	for (auto _ : state)
+	{
+		const char* p = text.data();
+		const char* end = p + text.size();
+		for (size_t i = 0; i < count; ++i)
+		{
+			p = std::from_chars(p, end, values[i]).ptr + 1;
+		}
+		benchmark::DoNotOptimize(values.data());
+	}
+	state.SetBytesProcessed(state.iterations() * text.size());
+}
+BENCHMARK(BM_FromChars);
+
+static void BM_Str2IntBatch(benchmark::State& state)
+{
+	std::string text = make_column(false, count);
+	std::vector<int> values(count);
+	size_t parsed = 0;
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(str2int_batch(text.data(), text.size(), '\n',
+											   values.data(), count, &parsed));
+	}
+	state.SetBytesProcessed(state.iterations() * text.size());
+}
+BENCHMARK(BM_Str2IntBatch);
+
+static void BM_FromChars64(benchmark::State& state)
+{
+	std::string text = make_column(true, count);
+	std::vector<int64_t> values(count);
+	for (auto _ : state)
+	{
+		const char* p = text.data();
+		const char* end = p + text.size();
+		for (size_t i = 0; i < count; ++i)
+		{
+			p = std::from_chars(p, end, values[i]).ptr + 1;
+		}
+		benchmark::DoNotOptimize(values.data());
+	}
+	state.SetBytesProcessed(state.iterations() * text.size());
+}
+BENCHMARK(BM_FromChars64);
+
+static void BM_Str2Int64N(benchmark::State& state)
+{
+	std::string text = make_column(true, count);
+	std::vector<int64_t> values(count);
+	for (auto _ : state)
+	{
+		const char* p = text.data();
+		for (size_t i = 0; i < count; ++i)
+		{
+			size_t len = 0;
+			while (p[len] != '\n')
+			{
+				++len;
+			}
+			str2int64_n(p, len, &values[i]);
+			p += len + 1;
+		}
+		benchmark::DoNotOptimize(values.data());
+	}
+	state.SetBytesProcessed(state.iterations() * text.size());
+}
+BENCHMARK(BM_Str2Int64N);
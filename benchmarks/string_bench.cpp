@@ -0,0 +1,84 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include "bmstu_string.h"
+
+namespace
+{
+const char* sample_text(size_t size)
+{
+	static std::string text;
+	text.assign(size, ' ');
+	for (size_t i = 0; i < size; ++i)
+	{
+		text[i] = static_cast<char>('a' + (i * 7) % 26);
+	}
+	return text.c_str();
+}
+}  // namespace
+
+template <typename String>
+static void BM_StringConstruct(benchmark::State& state)
+{
+	const char* text = sample_text(static_cast<size_t>(state.range(0)));
+	for (auto _ : state)
+	{
+		String str(text);
+		benchmark::DoNotOptimize(str.c_str());
+	}
+	state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_StringConstruct, std::string)->Arg(8)->Arg(4 << 10);
+BENCHMARK_TEMPLATE(BM_StringConstruct, bmstu::string)->Arg(8)->Arg(4 << 10);
+
+template <typename String>
+static void BM_StringAppendChar(benchmark::State& state)
+{
+	int count = static_cast<int>(state.range(0));
+	for (auto _ : state)
+	{
+		String str;
+		for (int i = 0; i < count; ++i)
+		{
+			str += static_cast<char>('a' + i % 26);
+		}
+		benchmark::DoNotOptimize(str.c_str());
+	}
+	state.SetBytesProcessed(state.iterations() * count);
+}
+BENCHMARK_TEMPLATE(BM_StringAppendChar, std::string)->Arg(4 << 10);
+BENCHMARK_TEMPLATE(BM_StringAppendChar, bmstu::string)->Arg(4 << 10);
+
+template <typename String>
+static void BM_StringAppendString(benchmark::State& state)
+{
+	String word(sample_text(16));
+	int count = static_cast<int>(state.range(0));
+	for (auto _ : state)
+	{
+		String str;
+		for (int i = 0; i < count; ++i)
+		{
+			str += word;
+		}
+		benchmark::DoNotOptimize(str.c_str());
+	}
+	state.SetBytesProcessed(state.iterations() * count * 16);
+}
+BENCHMARK_TEMPLATE(BM_StringAppendString, std::string)->Arg(1 << 10);
+BENCHMARK_TEMPLATE(BM_StringAppendString, bmstu::string)->Arg(1 << 10);
+
+template <typename String>
+static void BM_StringConcat(benchmark::State& state)
+{
+	String left(sample_text(static_cast<size_t>(state.range(0))));
+	String right(left);
+	for (auto _ : state)
+	{
+		String joined = left + right;
+		benchmark::DoNotOptimize(joined.c_str());
+	}
+	state.SetBytesProcessed(state.iterations() * 2 * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_StringConcat, std::string)->Arg(8)->Arg(4 << 10);
+BENCHMARK_TEMPLATE(BM_StringConcat, bmstu::string)->Arg(8)->Arg(4 << 10);
@@ -0,0 +1,215 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <atomic>
+#include <future>
+#include <random>
+#include <thread>
+#include <vector>
+#include "thread_pool.h"
+
+/// Одни и те же ядра алгоритмов из let_1_2 (сумма положительных, удвоение
+/// элементов) на трех планировщиках: bmstu::thread_pool::parallel_for,
+/// куски через std::async и OpenMP, если компилятор его поддерживает
+namespace
+{
+std::vector<int> make_numbers(size_t size)
+{
+	std::mt19937 rng(1);
+	std::vector<int> v(size);
+	for (int& x : v)
+	{
+		x = static_cast<int>(rng());
+	}
+	return v;
+}
+
+constexpr int64_t size = 1 << 24;
+
+int64_t sum_positive(const int* first, const int* last)
+{
+	int64_t sum = 0;
+	for (; first != last; ++first)
+	{
+		sum += *first > 0 ? *first : 0;
+	}
+	return sum;
+}
+
+void double_values(int* first, int* last)
+{
+	for (; first != last; ++first)
+	{
+		*first *= 2;
+	}
+}
+
+size_t async_parts()
+{
+	return std::max(1u, std::thread::hardware_concurrency());
+}
+
+/// Делит [0, n) на async_parts() кусков, каждый в своем std::async
+template <typename F>
+void async_for(size_t n, F body)
+{
+	size_t parts = async_parts();
+	size_t step = n / parts;
+	std::vector<std::future<void>> futures;
+	futures.reserve(parts);
+	for (size_t i = 0; i < parts; ++i)
+	{
+		size_t lo = i * step;
+		size_t hi = i + 1 == parts ? n : lo + step;
+		futures.push_back(
+			std::async(std::launch::async, [=, &body] { body(lo, hi); }));
+	}
+	for (std::future<void>& future : futures)
+	{
+		future.get();
+	}
+}
+}  // namespace
+
+static void BM_SumPositivePool(benchmark::State& state)
+{
+	std::vector<int> v = make_numbers(size);
+	bmstu::thread_pool& pool = bmstu::thread_pool::shared();
+	for (auto _ : state)
+	{
+		std::atomic<int64_t> sum{0};
+		pool.parallel_for(0, v.size(),
+						  [&](size_t lo, size_t hi)
+						  {
+							  sum.fetch_add(sum_positive(v.data() + lo,
+														 v.data() + hi),
+											std::memory_order_relaxed);
+						  });
+		benchmark::DoNotOptimize(sum.load());
+	}
+	state.SetItemsProcessed(state.iterations() * size);
+}
+BENCHMARK(BM_SumPositivePool)->UseRealTime();
+
+static void BM_SumPositiveAsync(benchmark::State& state)
+{
+	std::vector<int> v = make_numbers(size);
+	for (auto _ : state)
+	{
+		std::atomic<int64_t> sum{0};
+		async_for(v.size(),
+				  [&](size_t lo, size_t hi)
+				  {
+					  sum.fetch_add(sum_positive(v.data() + lo, v.data() + hi),
+									std::memory_order_relaxed);
+				  });
+		benchmark::DoNotOptimize(sum.load());
+	}
+	state.SetItemsProcessed(state.iterations() * size);
+}
+BENCHMARK(BM_SumPositiveAsync)->UseRealTime();
+
+static void BM_DoublePool(benchmark::State& state)
+{
+	std::vector<int> v = make_numbers(size);
+	bmstu::thread_pool& pool = bmstu::thread_pool::shared();
+	for (auto _ : state)
+	{
+		pool.parallel_for(0, v.size(), [&](size_t lo, size_t hi)
+						  { double_values(v.data() + lo, v.data() + hi); });
+		benchmark::DoNotOptimize(v.data());
+	}
+	state.SetItemsProcessed(state.iterations() * size);
+}
+BENCHMARK(BM_DoublePool)->UseRealTime();
+
+static void BM_DoubleAsync(benchmark::State& state)
+{
+	std::vector<int> v = make_numbers(size);
+	for (auto _ : state)
+	{
+		async_for(v.size(), [&](size_t lo, size_t hi)
+				  { double_values(v.data() + lo, v.data() + hi); });
+		benchmark::DoNotOptimize(v.data());
+	}
+	state.SetItemsProcessed(state.iterations() * size);
+}
+BENCHMARK(BM_DoubleAsync)->UseRealTime();
+
+#ifdef _OPENMP
+static void BM_SumPositiveOpenMP(benchmark::State& state)
+{
+	std::vector<int> v = make_numbers(size);
+	const int* data = v.data();
+	for (auto _ : state)
+	{
+		int64_t sum = 0;
+#pragma omp parallel for reduction(+ : sum)
+		for (int64_t i = 0; i < size; ++i)
+		{
+			sum += data[i] > 0 ? data[i] : 0;
+		}
+		benchmark::DoNotOptimize(sum);
+	}
+	state.SetItemsProcessed(state.iterations() * size);
+}
+BENCHMARK(BM_SumPositiveOpenMP)->UseRealTime();
+
+static void BM_DoubleOpenMP(benchmark::State& state)
+{
+	std::vector<int> v = make_numbers(size);
+	int* data = v.data();
+	for (auto _ : state)
+	{
+#pragma omp parallel for
+		for (int64_t i = 0; i < size; ++i)
+		{
+			data[i] *= 2;
+		}
+		benchmark::DoNotOptimize(data);
+	}
+	state.SetItemsProcessed(state.iterations() * size);
+}
+BENCHMARK(BM_DoubleOpenMP)->UseRealTime();
+#endif
+
+/// Накладные расходы на задачу: много крошечных задач и одно ожидание
+static void BM_SpawnWaitPool(benchmark::State& state)
+{
+	bmstu::thread_pool& pool = bmstu::thread_pool::shared();
+	int64_t tasks = state.range(0);
+	for (auto _ : state)
+	{
+		std::atomic<int64_t> done{0};
+		pool.parallel_for(
+			0, static_cast<size_t>(tasks),
+			[&](size_t) { done.fetch_add(1, std::memory_order_relaxed); }, 1);
+		benchmark::DoNotOptimize(done.load());
+	}
+	state.SetItemsProcessed(state.iterations() * tasks);
+}
+BENCHMARK(BM_SpawnWaitPool)->Arg(1 << 10)->UseRealTime();
+
+static void BM_SpawnWaitAsync(benchmark::State& state)
+{
+	int64_t tasks = state.range(0);
+	for (auto _ : state)
+	{
+		std::atomic<int64_t> done{0};
+		std::vector<std::future<void>> futures;
+		futures.reserve(static_cast<size_t>(tasks));
+		for (int64_t i = 0; i < tasks; ++i)
+		{
+			futures.push_back(std::async(
+				std::launch::async,
+				[&] { done.fetch_add(1, std::memory_order_relaxed); }));
+		}
+		for (std::future<void>& future : futures)
+		{
+			future.get();
+		}
+		benchmark::DoNotOptimize(done.load());
+	}
+	state.SetItemsProcessed(state.iterations() * tasks);
+}
+BENCHMARK(BM_SpawnWaitAsync)->Arg(1 << 10)->UseRealTime();
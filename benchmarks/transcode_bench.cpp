@@ -0,0 +1,92 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include "transcode.h"
+
+namespace
+{
+/// Корпуса разного состава: чистый ASCII, латиница с кириллицей, CJK, эмодзи
+const char* corpus_sample(int kind)
+{
+	switch (kind)
+	{
+		case 0:
+			return "The quick brown fox jumps over the lazy dog. ";
+		case 1:
+			return "Request id 42: пользователь вошёл в систему, ok. ";
+		case 2:
+			return "日本語のテキストと中文字符, mixed with ASCII. ";
+		default:
+			return "status \U0001F680 deployed \U0001F600 ok ✓ ";
+	}
+}
+
+bmstu::string make_corpus(int kind, size_t size)
+{
+	std::string text;
+	while (text.size() < size)
+	{
+		text += corpus_sample(kind);
+	}
+	return bmstu::string(text.c_str());
+}
+
+const char* corpus_name(int kind)
+{
+	static const char* names[] = {"ascii", "cyrillic", "cjk", "emoji"};
+	return names[kind];
+}
+}  // namespace
+
+static void BM_TranscodeUtf8ToUtf16(benchmark::State& state)
+{
+	bmstu::string src = make_corpus(static_cast<int>(state.range(0)), 1 << 20);
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(bmstu::transcode<char16_t>(src));
+	}
+	state.SetLabel(corpus_name(static_cast<int>(state.range(0))));
+	state.SetBytesProcessed(state.iterations() *
+							static_cast<int64_t>(src.size()));
+}
+BENCHMARK(BM_TranscodeUtf8ToUtf16)->DenseRange(0, 3);
+
+static void BM_TranscodeUtf8ToUtf32(benchmark::State& state)
+{
+	bmstu::string src = make_corpus(static_cast<int>(state.range(0)), 1 << 20);
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(bmstu::transcode<char32_t>(src));
+	}
+	state.SetLabel(corpus_name(static_cast<int>(state.range(0))));
+	state.SetBytesProcessed(state.iterations() *
+							static_cast<int64_t>(src.size()));
+}
+BENCHMARK(BM_TranscodeUtf8ToUtf32)->DenseRange(0, 3);
+
+static void BM_TranscodeUtf16ToUtf8(benchmark::State& state)
+{
+	bmstu::u16string src = bmstu::transcode<char16_t>(
+		make_corpus(static_cast<int>(state.range(0)), 1 << 20));
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(bmstu::transcode<char>(src));
+	}
+	state.SetLabel(corpus_name(static_cast<int>(state.range(0))));
+	state.SetBytesProcessed(state.iterations() *
+							static_cast<int64_t>(src.size() * 2));
+}
+BENCHMARK(BM_TranscodeUtf16ToUtf8)->DenseRange(0, 3);
+
+static void BM_ValidateUtf8(benchmark::State& state)
+{
+	bmstu::string src = make_corpus(static_cast<int>(state.range(0)), 1 << 20);
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(bmstu::is_valid_unicode(src));
+	}
+	state.SetLabel(corpus_name(static_cast<int>(state.range(0))));
+	state.SetBytesProcessed(state.iterations() *
+							static_cast<int64_t>(src.size()));
+}
+BENCHMARK(BM_ValidateUtf8)->DenseRange(0, 3);
@@ -0,0 +1,69 @@
+# Режимы сборки: оптимизация под процессор, LTO, двухэтапный PGO и
+# санитайзеры. Готовые наборы - в CMakePresets.json
+
+option(BMSTU_NATIVE "Optimize for the host CPU (-march=native)" OFF)
+option(BMSTU_LTO "Link-time optimization (ThinLTO with Clang)" OFF)
+set(BMSTU_PGO "OFF" CACHE STRING "PGO stage: OFF, GENERATE or USE")
+set_property(CACHE BMSTU_PGO PROPERTY STRINGS OFF GENERATE USE)
+set(BMSTU_PGO_DIR "${CMAKE_SOURCE_DIR}/build/pgo-profile" CACHE PATH
+        "Directory with PGO profiles shared by both stages")
+set(BMSTU_SANITIZE "" CACHE STRING
+        "Sanitizers for all targets, e.g. address;undefined or thread")
+
+if(BMSTU_NATIVE)
+    add_compile_options(-march=native)
+endif()
+
+if(BMSTU_LTO)
+    # Для Clang CMake включает -flto=thin, для GCC - обычный LTO
+    include(CheckIPOSupported)
+    check_ipo_supported(RESULT BMSTU_IPO_SUPPORTED OUTPUT BMSTU_IPO_ERROR)
+    if(NOT BMSTU_IPO_SUPPORTED)
+        message(FATAL_ERROR "BMSTU_LTO: ${BMSTU_IPO_ERROR}")
+    endif()
+    set(CMAKE_INTERPROCEDURAL_OPTIMIZATION ON)
+endif()
+
+string(TOUPPER "${BMSTU_PGO}" BMSTU_PGO)
+if(CMAKE_CXX_COMPILER_ID MATCHES "Clang")
+    # Clang читает один слитый профиль, его собирает bmstu_pgo_train
+    set(BMSTU_PGO_PROFILE "${BMSTU_PGO_DIR}/bmstu.profdata")
+    set(BMSTU_PGO_USE_FLAGS -fprofile-use=${BMSTU_PGO_PROFILE})
+else()
+    # GCC называет .gcda по пути объектного файла. Пути считаются от
+    # каталога сборки, иначе pgo-use в build/pgo-use не найдет профили,
+    # записанные из build/pgo-generate
+    set(BMSTU_PGO_PREFIX_FLAGS -fprofile-prefix-path=${CMAKE_BINARY_DIR})
+    set(BMSTU_PGO_USE_FLAGS -fprofile-use=${BMSTU_PGO_DIR}
+            -fprofile-partial-training ${BMSTU_PGO_PREFIX_FLAGS})
+endif()
+if(BMSTU_PGO STREQUAL "GENERATE")
+    # atomic: счетчики не теряются в многопоточных тестах и бенчмарках
+    add_compile_options(-fprofile-generate=${BMSTU_PGO_DIR}
+            -fprofile-update=atomic ${BMSTU_PGO_PREFIX_FLAGS})
+    add_link_options(-fprofile-generate=${BMSTU_PGO_DIR})
+elseif(BMSTU_PGO STREQUAL "USE")
+    if(BMSTU_PGO_PROFILE AND NOT EXISTS "${BMSTU_PGO_PROFILE}")
+        message(FATAL_ERROR "BMSTU_PGO=USE: no profile ${BMSTU_PGO_PROFILE}, "
+                "build bmstu_pgo_train in a BMSTU_PGO=GENERATE tree first")
+    endif()
+    if(NOT BMSTU_PGO_PROFILE)
+        file(GLOB_RECURSE BMSTU_PGO_GCDA "${BMSTU_PGO_DIR}/*.gcda")
+        if(NOT BMSTU_PGO_GCDA)
+            message(FATAL_ERROR "BMSTU_PGO=USE: no .gcda files in "
+                    "${BMSTU_PGO_DIR}, build bmstu_pgo_train in a "
+                    "BMSTU_PGO=GENERATE tree first")
+        endif()
+    endif()
+    add_compile_options(${BMSTU_PGO_USE_FLAGS})
+    add_link_options(${BMSTU_PGO_USE_FLAGS})
+elseif(NOT BMSTU_PGO STREQUAL "OFF")
+    message(FATAL_ERROR "BMSTU_PGO must be OFF, GENERATE or USE")
+endif()
+
+if(BMSTU_SANITIZE)
+    list(JOIN BMSTU_SANITIZE "," BMSTU_SANITIZE_LIST)
+    add_compile_options(-fsanitize=${BMSTU_SANITIZE_LIST}
+            -fno-sanitize-recover=all -fno-omit-frame-pointer)
+    add_link_options(-fsanitize=${BMSTU_SANITIZE_LIST})
+endif()
@@ -0,0 +1,86 @@
+# Header-only библиотека контейнеров bmstu::containers. Заголовки остаются
+# в папках задач, при установке они собираются в include/bmstu вместе со
+# сгенерированным bmstu/all.hpp
+
+option(BMSTU_PCH "Precompile bmstu/all.hpp for targets using bmstu::containers" OFF)
+
+set(BMSTU_CONTAINERS_VERSION 1.0.0)
+set(BMSTU_ROOT ${CMAKE_CURRENT_LIST_DIR}/..)
+set(BMSTU_CONTAINER_HEADERS
+        tasks/bmstu_hash/task_hash/bmstu_hash.h
+        tasks/bmstu_stats/task_stats/bmstu_stats.h
+        tasks/bmstu_format/task_format/bmstu_format.h
+        tasks/bmstu_abstract_iterator/task_abstract_iterator/abstract_iterator.h
+        tasks/bmstu_simple_vector/task_simple_vector/array_ptr.h
+        tasks/bmstu_simple_vector/task_simple_vector/bmstu_simple_vector.h
+        tasks/bmstu_simple_vector/task_simple_vector/concurrent_vector.h
+        tasks/bmstu_list/task_list/bmstu_list.h
+        tasks/bmstu_string/task_simple_string/bmstu_string.h
+        tasks/bmstu_string/task_simple_string/string_builder.h
+        tasks/bmstu_string/task_simple_string/string_pool.h
+        tasks/bmstu_string/task_simple_string/transcode.h
+        tasks/bmstu_serialize/task_serialize/bmstu_serialize.h
+        tasks/bmstu_thread_pool/task_thread_pool/thread_pool.h
+        tasks/bmstu_channel/task_channel/bmstu_executor.h
+        tasks/bmstu_channel/task_channel/bmstu_channel.h)
+
+set(BMSTU_ALL_INCLUDES "")
+set(BMSTU_HEADER_FILES "")
+set(BMSTU_HEADER_DIRS "")
+foreach(HEADER ${BMSTU_CONTAINER_HEADERS})
+    get_filename_component(HEADER_NAME ${HEADER} NAME)
+    get_filename_component(HEADER_DIR ${BMSTU_ROOT}/${HEADER} DIRECTORY)
+    string(APPEND BMSTU_ALL_INCLUDES "#include \"${HEADER_NAME}\"\n")
+    list(APPEND BMSTU_HEADER_FILES ${BMSTU_ROOT}/${HEADER})
+    list(APPEND BMSTU_HEADER_DIRS $<BUILD_INTERFACE:${HEADER_DIR}>)
+endforeach()
+list(REMOVE_DUPLICATES BMSTU_HEADER_DIRS)
+
+set(BMSTU_GENERATED_INCLUDE ${CMAKE_BINARY_DIR}/generated/include)
+configure_file(${CMAKE_CURRENT_LIST_DIR}/all.hpp.in
+        ${BMSTU_GENERATED_INCLUDE}/bmstu/all.hpp @ONLY)
+
+find_package(Threads REQUIRED)
+add_library(bmstu_containers INTERFACE)
+add_library(bmstu::containers ALIAS bmstu_containers)
+set_target_properties(bmstu_containers PROPERTIES EXPORT_NAME containers)
+target_compile_features(bmstu_containers INTERFACE cxx_std_23)
+target_link_libraries(bmstu_containers INTERFACE Threads::Threads)
+# Заголовки подключают друг друга без префикса, поэтому доступны и
+# <bmstu/all.hpp>, и <bmstu_string.h>
+target_include_directories(bmstu_containers INTERFACE
+        ${BMSTU_HEADER_DIRS}
+        $<BUILD_INTERFACE:${BMSTU_GENERATED_INCLUDE}>
+        $<BUILD_INTERFACE:${BMSTU_GENERATED_INCLUDE}/bmstu>
+        $<INSTALL_INTERFACE:include>
+        $<INSTALL_INTERFACE:include/bmstu>)
+if(BMSTU_STATS)
+    target_compile_definitions(bmstu_containers INTERFACE BMSTU_STATS)
+endif()
+if(BMSTU_PCH)
+    # Каждый потребитель один раз компилирует all.hpp вместо разбора
+    # шаблонов в каждой единице трансляции
+    target_precompile_headers(bmstu_containers INTERFACE
+            "$<$<COMPILE_LANGUAGE:CXX>:$<BUILD_INTERFACE:${BMSTU_GENERATED_INCLUDE}/bmstu/all.hpp>>"
+            "$<$<COMPILE_LANGUAGE:CXX>:$<INSTALL_INTERFACE:<bmstu/all.hpp$<ANGLE-R>>>")
+endif()
+
+include(GNUInstallDirs)
+include(CMakePackageConfigHelpers)
+set(BMSTU_CONFIG_DIR ${CMAKE_INSTALL_LIBDIR}/cmake/bmstu)
+install(TARGETS bmstu_containers EXPORT bmstuTargets)
+install(FILES ${BMSTU_HEADER_FILES} ${BMSTU_GENERATED_INCLUDE}/bmstu/all.hpp
+        DESTINATION ${CMAKE_INSTALL_INCLUDEDIR}/bmstu)
+install(EXPORT bmstuTargets NAMESPACE bmstu:: DESTINATION ${BMSTU_CONFIG_DIR})
+export(EXPORT bmstuTargets NAMESPACE bmstu::
+        FILE ${CMAKE_BINARY_DIR}/bmstuTargets.cmake)
+configure_package_config_file(${CMAKE_CURRENT_LIST_DIR}/bmstuConfig.cmake.in
+        ${CMAKE_BINARY_DIR}/bmstuConfig.cmake
+        INSTALL_DESTINATION ${BMSTU_CONFIG_DIR})
+write_basic_package_version_file(${CMAKE_BINARY_DIR}/bmstuConfigVersion.cmake
+        VERSION ${BMSTU_CONTAINERS_VERSION}
+        COMPATIBILITY SameMajorVersion
+        ARCH_INDEPENDENT)
+install(FILES ${CMAKE_BINARY_DIR}/bmstuConfig.cmake
+        ${CMAKE_BINARY_DIR}/bmstuConfigVersion.cmake
+        DESTINATION ${BMSTU_CONFIG_DIR})
@@ -0,0 +1,286 @@
+#pragma once
+#include <coroutine>
+#include <cstddef>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include "bmstu_executor.h"
+#include "bmstu_list.h"
+
+namespace bmstu
+{
+/// Ограниченный канал между корутинами bmstu::task. co_await send(v)
+/// приостанавливает отправителя, пока буфер полон; co_await recv()
+/// возвращает std::optional<T>, пустой после close и опустошения буфера.
+/// Буфер - узлы bmstu::list, ожидающие хранятся в кадрах своих корутин и
+/// не требуют выделений; разбуженная корутина продолжается на своем
+/// исполнителе. capacity 0 - передача из рук в руки. К разрушению канала
+/// ожидающих быть не должно
+template <typename T>
+class channel
+{
+	/// Ожидающая корутина. value - отправляемое значение или место под
+	/// принятое
+	struct waiter
+	{
+		std::coroutine_handle<> handle;
+		executor* where = nullptr;
+		T* value = nullptr;
+		std::optional<T>* slot = nullptr;
+		bool done = false;
+		waiter* next = nullptr;
+	};
+
+	/// Очередь ожидающих в порядке прихода
+	struct waiter_queue
+	{
+		void push(waiter* w) noexcept
+		{
+			w->next = nullptr;
+			(last == nullptr ? first : last->next) = w;
+			last = w;
+		}
+
+		waiter* pop() noexcept
+		{
+			waiter* w = first;
+			first = w->next;
+			if (first == nullptr)
+			{
+				last = nullptr;
+			}
+			return w;
+		}
+
+		bool empty() const noexcept { return first == nullptr; }
+
+		waiter* first = nullptr;
+		waiter* last = nullptr;
+	};
+
+	class send_awaiter
+	{
+	   public:
+		send_awaiter(channel& owner, T&& value)
+			: owner_(owner), value_(std::move(value))
+		{
+		}
+
+		bool await_ready() const noexcept { return false; }
+
+		template <typename Promise>
+		bool await_suspend(std::coroutine_handle<Promise> handle)
+		{
+			waiter* woken = nullptr;
+			{
+				std::lock_guard lock(owner_.mutex_);
+				if (owner_.closed_)
+				{
+					return false;
+				}
+				if (!owner_.put_(value_, woken))
+				{
+					self_ = {handle, handle.promise().where};
+					self_.value = &value_;
+					owner_.senders_.push(&self_);
+					return true;
+				}
+			}
+			self_.done = true;
+			wake_(woken);
+			return false;
+		}
+
+		/// false - канал закрыт, значение не отправлено
+		bool await_resume() const noexcept { return self_.done; }
+
+	   private:
+		channel& owner_;
+		T value_;
+		waiter self_;
+	};
+
+	class recv_awaiter
+	{
+	   public:
+		explicit recv_awaiter(channel& owner) noexcept : owner_(owner) {}
+
+		bool await_ready() const noexcept { return false; }
+
+		template <typename Promise>
+		bool await_suspend(std::coroutine_handle<Promise> handle)
+		{
+			waiter* woken = nullptr;
+			{
+				std::lock_guard lock(owner_.mutex_);
+				if (!owner_.take_(value_, woken))
+				{
+					if (owner_.closed_)
+					{
+						return false;
+					}
+					self_ = {handle, handle.promise().where};
+					self_.slot = &value_;
+					owner_.receivers_.push(&self_);
+					return true;
+				}
+			}
+			wake_(woken);
+			return false;
+		}
+
+		std::optional<T> await_resume() noexcept(
+			std::is_nothrow_move_constructible_v<T>)
+		{
+			return std::move(value_);
+		}
+
+	   private:
+		channel& owner_;
+		std::optional<T> value_;
+		waiter self_;
+	};
+
+   public:
+	explicit channel(size_t capacity) : capacity_(capacity) {}
+
+	channel(const channel&) = delete;
+	channel& operator=(const channel&) = delete;
+
+	/// co_await возвращает false, если канал закрыт
+	send_awaiter send(T value)
+	{
+		return send_awaiter(*this, std::move(value));
+	}
+
+	/// co_await возвращает значение или пустой optional после close
+	recv_awaiter recv() noexcept { return recv_awaiter(*this); }
+
+	/// Отправка без ожидания: false, если буфер полон или канал закрыт
+	bool try_send(T value)
+	{
+		waiter* woken = nullptr;
+		{
+			std::lock_guard lock(mutex_);
+			if (closed_ || !put_(value, woken))
+			{
+				return false;
+			}
+		}
+		wake_(woken);
+		return true;
+	}
+
+	/// Прием без ожидания: пустой optional, если значений нет
+	std::optional<T> try_recv()
+	{
+		std::optional<T> value;
+		waiter* woken = nullptr;
+		{
+			std::lock_guard lock(mutex_);
+			take_(value, woken);
+		}
+		wake_(woken);
+		return value;
+	}
+
+	/// Новые send возвращают false, ждущие получатели просыпаются с пустым
+	/// optional, ждущие отправители - с false. Значения в буфере остаются
+	void close()
+	{
+		waiter_queue senders;
+		waiter_queue receivers;
+		{
+			std::lock_guard lock(mutex_);
+			closed_ = true;
+			std::swap(senders, senders_);
+			std::swap(receivers, receivers_);
+		}
+		while (!senders.empty())
+		{
+			wake_(senders.pop());
+		}
+		while (!receivers.empty())
+		{
+			wake_(receivers.pop());
+		}
+	}
+
+	bool closed() const
+	{
+		std::lock_guard lock(mutex_);
+		return closed_;
+	}
+
+	/// Значений в буфере
+	size_t size() const
+	{
+		std::lock_guard lock(mutex_);
+		return buffer_.size();
+	}
+
+	size_t capacity() const noexcept { return capacity_; }
+
+   private:
+	/// Под mutex_: отдает value ждущему получателю или кладет в буфер
+	bool put_(T& value, waiter*& woken)
+	{
+		if (!receivers_.empty())
+		{
+			woken = receivers_.pop();
+			woken->slot->emplace(std::move(value));
+			return true;
+		}
+		if (buffer_.size() < capacity_)
+		{
+			buffer_.push_back(std::move(value));
+			return true;
+		}
+		return false;
+	}
+
+	/// Под mutex_: берет значение из буфера или у ждущего отправителя,
+	/// освободившееся место занимает следующий отправитель
+	bool take_(std::optional<T>& value, waiter*& woken)
+	{
+		if (!buffer_.empty())
+		{
+			value.emplace(std::move(buffer_.front()));
+			buffer_.pop_front();
+			if (!senders_.empty())
+			{
+				woken = senders_.pop();
+				buffer_.push_back(std::move(*woken->value));
+				woken->done = true;
+			}
+			return true;
+		}
+		if (!senders_.empty())
+		{
+			woken = senders_.pop();
+			value.emplace(std::move(*woken->value));
+			woken->done = true;
+			return true;
+		}
+		return false;
+	}
+
+	/// Вне mutex_: после schedule ожидающий может сразу продолжиться и
+	/// разрушить waiter
+	static void wake_(waiter* woken)
+	{
+		if (woken != nullptr)
+		{
+			woken->where->schedule(woken->handle);
+		}
+	}
+
+	size_t capacity_;
+	mutable std::mutex mutex_;
+	bool closed_ = false;
+	list<T> buffer_;
+	waiter_queue senders_;
+	waiter_queue receivers_;
+};
+}  // namespace bmstu
@@ -0,0 +1,210 @@
+#include "bmstu_channel.h"
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace
+{
+bmstu::task produce(bmstu::channel<int>& out, int first, int last)
+{
+	for (int i = first; i < last; ++i)
+	{
+		co_await out.send(i);
+	}
+}
+
+bmstu::task consume(bmstu::channel<int>& in, long long& sum, int& count)
+{
+	while (std::optional<int> value = co_await in.recv())
+	{
+		sum += *value;
+		++count;
+	}
+}
+
+/// Читает из in, прибавляет 1 и пишет в out; закрывает out после in
+bmstu::task forward(bmstu::channel<int>& in, bmstu::channel<int>& out)
+{
+	while (std::optional<int> value = co_await in.recv())
+	{
+		co_await out.send(*value + 1);
+	}
+	out.close();
+}
+
+bmstu::task produce_and_close(bmstu::channel<int>& out, int count)
+{
+	for (int i = 0; i < count; ++i)
+	{
+		co_await out.send(i);
+	}
+	out.close();
+}
+}  // namespace
+
+TEST(Channel, SingleThreadPipeline)
+{
+	bmstu::single_thread_executor executor;
+	bmstu::channel<int> ch(4);
+	long long sum = 0;
+	int count = 0;
+	bmstu::spawn(executor, produce_and_close(ch, 1000));
+	bmstu::spawn(executor, consume(ch, sum, count));
+	executor.run();
+	ASSERT_EQ(count, 1000);
+	ASSERT_EQ(sum, 999 * 1000 / 2);
+	ASSERT_TRUE(ch.closed());
+	ASSERT_EQ(ch.size(), 0u);
+}
+
+TEST(Channel, BufferBoundsSender)
+{
+	bmstu::single_thread_executor executor;
+	bmstu::channel<int> ch(3);
+	bmstu::spawn(executor, produce(ch, 0, 10));
+	executor.run();
+	// Отправитель ждет на четвертом значении
+	ASSERT_EQ(ch.size(), 3u);
+	ASSERT_EQ(ch.try_recv(), 0);
+	executor.run();
+	ASSERT_EQ(ch.size(), 3u);
+	for (int i = 1; i < 10; ++i)
+	{
+		ASSERT_EQ(ch.try_recv(), i);
+		executor.run();
+	}
+	ASSERT_EQ(ch.try_recv(), std::nullopt);
+}
+
+TEST(Channel, Rendezvous)
+{
+	bmstu::single_thread_executor executor;
+	bmstu::channel<std::string> ch(0);
+	ASSERT_FALSE(ch.try_send("lost"));
+	std::vector<std::string> received;
+	auto receive = [&]() -> bmstu::task
+	{
+		while (std::optional<std::string> s = co_await ch.recv())
+		{
+			received.push_back(std::move(*s));
+		}
+	};
+	bmstu::spawn(executor, receive());
+	executor.run();
+	ASSERT_TRUE(ch.try_send("a"));
+	// Получатель еще не вернулся к recv: передавать некому
+	ASSERT_FALSE(ch.try_send("lost"));
+	executor.run();
+	ASSERT_TRUE(ch.try_send(std::string(100, 'b')));
+	executor.run();
+	ch.close();
+	executor.run();
+	ASSERT_EQ(received.size(), 2u);
+	ASSERT_EQ(received[1].size(), 100u);
+	ASSERT_EQ(ch.size(), 0u);
+}
+
+TEST(Channel, CloseWakesWaiters)
+{
+	bmstu::single_thread_executor executor;
+	bmstu::channel<int> full(1);
+	bmstu::channel<int> empty(1);
+	ASSERT_TRUE(full.try_send(7));
+	std::vector<bool> sent;
+	std::vector<std::optional<int>> received;
+	auto send = [&]() -> bmstu::task
+	{ sent.push_back(co_await full.send(8)); };
+	auto receive = [&]() -> bmstu::task
+	{ received.push_back(co_await empty.recv()); };
+	for (int i = 0; i < 3; ++i)
+	{
+		bmstu::spawn(executor, send());
+		bmstu::spawn(executor, receive());
+	}
+	executor.run();
+	ASSERT_TRUE(sent.empty());
+	ASSERT_TRUE(received.empty());
+	full.close();
+	empty.close();
+	executor.run();
+	ASSERT_EQ(sent, std::vector<bool>(3, false));
+	ASSERT_EQ(received, std::vector<std::optional<int>>(3));
+	// Буфер читается и после закрытия
+	ASSERT_EQ(full.try_recv(), 7);
+	ASSERT_FALSE(full.try_send(9));
+}
+
+TEST(Channel, ThousandsOfStages)
+{
+	constexpr int stages = 5000;
+	bmstu::single_thread_executor executor;
+	std::vector<std::unique_ptr<bmstu::channel<int>>> channels;
+	for (int i = 0; i <= stages; ++i)
+	{
+		channels.push_back(std::make_unique<bmstu::channel<int>>(1));
+	}
+	for (int i = 0; i < stages; ++i)
+	{
+		bmstu::spawn(executor, forward(*channels[i], *channels[i + 1]));
+	}
+	long long sum = 0;
+	int count = 0;
+	bmstu::spawn(executor, consume(*channels[stages], sum, count));
+	bmstu::spawn(executor, produce_and_close(*channels[0], 100));
+	executor.run();
+	ASSERT_EQ(count, 100);
+	ASSERT_EQ(sum, 99 * 100 / 2 + 100LL * stages);
+}
+
+TEST(Channel, PoolExecutor)
+{
+	constexpr int producers = 8;
+	constexpr int per_producer = 5000;
+	bmstu::thread_pool pool(4);
+	bmstu::pool_executor executor(pool);
+	bmstu::channel<int> ch(16);
+	bmstu::channel<int> done(producers);
+	std::atomic<long long> sum{0};
+	std::atomic<int> count{0};
+	auto send = [&](int first) -> bmstu::task
+	{
+		for (int i = first; i < first + per_producer; ++i)
+		{
+			co_await ch.send(i);
+		}
+		co_await done.send(first);
+	};
+	auto receive = [&]() -> bmstu::task
+	{
+		while (std::optional<int> value = co_await ch.recv())
+		{
+			sum.fetch_add(*value);
+			count.fetch_add(1);
+		}
+	};
+	auto closer = [&]() -> bmstu::task
+	{
+		for (int i = 0; i < producers; ++i)
+		{
+			co_await done.recv();
+		}
+		ch.close();
+	};
+	for (int i = 0; i < 4; ++i)
+	{
+		bmstu::spawn(executor, receive());
+	}
+	bmstu::spawn(executor, closer());
+	for (int i = 0; i < producers; ++i)
+	{
+		bmstu::spawn(executor, send(i * per_producer));
+	}
+	pool.wait();
+	long long total = producers * per_producer;
+	ASSERT_EQ(count.load(), total);
+	ASSERT_EQ(sum.load(), (total - 1) * total / 2);
+}
@@ -0,0 +1,136 @@
+#pragma once
+#include <coroutine>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <utility>
+#include "thread_pool.h"
+
+namespace bmstu
+{
+/// Где продолжаются приостановленные корутины. schedule можно вызывать из
+/// любого потока
+class executor
+{
+   public:
+	virtual ~executor() = default;
+
+	virtual void schedule(std::coroutine_handle<> handle) = 0;
+};
+
+/// Однопоточный исполнитель: run возобновляет корутины из очереди в
+/// вызывающем потоке, пока очередь не опустеет
+class single_thread_executor final : public executor
+{
+   public:
+	void schedule(std::coroutine_handle<> handle) override
+	{
+		std::lock_guard lock(mutex_);
+		ready_.push_back(handle);
+	}
+
+	/// Число возобновлений
+	size_t run()
+	{
+		size_t resumed = 0;
+		while (true)
+		{
+			std::coroutine_handle<> handle;
+			{
+				std::lock_guard lock(mutex_);
+				if (ready_.empty())
+				{
+					return resumed;
+				}
+				handle = ready_.front();
+				ready_.pop_front();
+			}
+			handle.resume();
+			++resumed;
+		}
+	}
+
+   private:
+	std::mutex mutex_;
+	std::deque<std::coroutine_handle<>> ready_;
+};
+
+/// Возобновляет корутины задачами thread_pool. pool.wait() возвращается,
+/// когда все корутины завершились или ждут
+class pool_executor final : public executor
+{
+   public:
+	explicit pool_executor(thread_pool& pool = thread_pool::shared()) noexcept
+		: pool_(pool)
+	{
+	}
+
+	void schedule(std::coroutine_handle<> handle) override
+	{
+		pool_.post([handle] { handle.resume(); });
+	}
+
+	thread_pool& pool() const noexcept { return pool_; }
+
+   private:
+	thread_pool& pool_;
+};
+
+/// Корутина-стадия конвейера. Создается приостановленной, spawn ставит ее
+/// на исполнитель, кадр освобождается по завершении. Исключение из стадии,
+/// как из std::thread, завершает программу
+class task
+{
+   public:
+	struct promise_type
+	{
+		task get_return_object() noexcept
+		{
+			return task(std::coroutine_handle<promise_type>::from_promise(
+				*this));
+		}
+
+		std::suspend_always initial_suspend() noexcept { return {}; }
+
+		std::suspend_never final_suspend() noexcept { return {}; }
+
+		void return_void() noexcept {}
+
+		void unhandled_exception() noexcept { std::terminate(); }
+
+		/// Исполнитель, на котором корутина продолжается после ожидания
+		executor* where = nullptr;
+	};
+
+	task(task&& other) noexcept : handle_(std::exchange(other.handle_, {})) {}
+
+	task& operator=(task&&) = delete;
+
+	~task()
+	{
+		if (handle_)
+		{
+			handle_.destroy();
+		}
+	}
+
+	friend void spawn(executor& where, task stage);
+
+   private:
+	explicit task(std::coroutine_handle<promise_type> handle) noexcept
+		: handle_(handle)
+	{
+	}
+
+	std::coroutine_handle<promise_type> handle_;
+};
+
+/// Запускает стадию на исполнителе where
+inline void spawn(executor& where, task stage)
+{
+	auto handle = std::exchange(stage.handle_, {});
+	handle.promise().where = &where;
+	where.schedule(handle);
+}
+}  // namespace bmstu
@@ -0,0 +1,227 @@
+#pragma once
+#include <algorithm>
+#include <charconv>
+#include <concepts>
+#include <cstddef>
+#include <cstring>
+#include <locale>
+#include <memory>
+#include <ostream>
+#include <string_view>
+#include <type_traits>
+#if __has_include(<format>)
+#include <format>
+#endif
+
+/// Печать контейнеров bmstu в поток: элементы собираются в черновой буфер
+/// и уходят в поток одним os.write вместо виртуального вызова и работы с
+/// локалью на каждый элемент
+
+namespace bmstu::detail
+{
+/// Числа, которые to_chars печатает так же, как os << value при флагах
+/// потока по умолчанию. Символьные типы шире char в ostream не печатаются
+template <typename T>
+concept fast_printable =
+	std::is_arithmetic_v<T> && !std::is_same_v<T, wchar_t> &&
+	!std::is_same_v<T, char8_t> && !std::is_same_v<T, char16_t> &&
+	!std::is_same_v<T, char32_t>;
+
+/// Поток с флагами, точностью, шириной и локалью по умолчанию
+inline bool plain_stream(const std::ostream& os)
+{
+	return os.flags() == (std::ios_base::dec | std::ios_base::skipws) &&
+		   os.precision() == 6 && os.width() == 0 &&
+		   os.getloc() == std::locale::classic();
+}
+
+/// Черновик вывода: первые inline_size_ байт на стеке, дальше в куче до
+/// flush_size_, после чего накопленное сбрасывается в поток. Остаток
+/// уходит в поток явным flush()
+class render_buffer
+{
+   public:
+	explicit render_buffer(std::ostream& os) noexcept : os_(os) {}
+
+	render_buffer(const render_buffer&) = delete;
+	render_buffer& operator=(const render_buffer&) = delete;
+
+	void append(std::string_view str)
+	{
+		std::memcpy(reserve_(str.size()), str.data(), str.size());
+		size_ += str.size();
+	}
+
+	void append(char symbol)
+	{
+		*reserve_(1) = symbol;
+		++size_;
+	}
+
+	/// Запись числа как у os << value: bool и char-типы - символом,
+	/// вещественные - %g с точностью 6
+	template <fast_printable T>
+	void append_number(T value)
+	{
+		if constexpr (std::is_same_v<T, bool>)
+		{
+			append(value ? '1' : '0');
+		}
+		else if constexpr (std::is_same_v<T, char> ||
+						   std::is_same_v<T, signed char> ||
+						   std::is_same_v<T, unsigned char>)
+		{
+			append(static_cast<char>(value));
+		}
+		else
+		{
+			char* first = reserve_(max_number_);
+			std::to_chars_result result;
+			if constexpr (std::is_floating_point_v<T>)
+			{
+				result = std::to_chars(first, first + max_number_, value,
+									   std::chars_format::general, 6);
+			}
+			else
+			{
+				result = std::to_chars(first, first + max_number_, value);
+			}
+			size_ += static_cast<size_t>(result.ptr - first);
+		}
+	}
+
+	size_t size() const noexcept { return size_; }
+
+	void flush()
+	{
+		if (size_ != 0)
+		{
+			os_.write(data_, static_cast<std::streamsize>(size_));
+			size_ = 0;
+		}
+	}
+
+   private:
+	static constexpr size_t inline_size_ = 512;
+	static constexpr size_t flush_size_ = 64 << 10;
+	/// С запасом на "-1.23457e+308" и 128-битные целые
+	static constexpr size_t max_number_ = 48;
+
+	char* reserve_(size_t count)
+	{
+		if (size_ + count > capacity_)
+		{
+			if (size_ + count <= flush_size_)
+			{
+				grow_(std::min(flush_size_, std::max(size_ + count,
+													 capacity_ * 2)));
+			}
+			else
+			{
+				flush();
+				if (count > capacity_)
+				{
+					grow_(count);
+				}
+			}
+		}
+		return data_ + size_;
+	}
+
+	void grow_(size_t new_cap)
+	{
+		std::unique_ptr<char[]> fresh(new char[new_cap]);
+		std::memcpy(fresh.get(), data_, size_);
+		heap_ = std::move(fresh);
+		data_ = heap_.get();
+		capacity_ = new_cap;
+	}
+
+	std::ostream& os_;
+	char inline_[inline_size_];
+	std::unique_ptr<char[]> heap_;
+	char* data_ = inline_;
+	size_t size_ = 0;
+	size_t capacity_ = inline_size_;
+};
+
+/// Печатает [first, last) как open e0 sep e1 ... close. Числа в потоке с
+/// флагами по умолчанию идут через render_buffer, остальное - поэлементно
+template <typename It>
+std::ostream& print_range(std::ostream& os, It first, It last,
+						  std::string_view open, std::string_view sep,
+						  std::string_view close)
+{
+	using T = std::remove_cvref_t<decltype(*first)>;
+	if constexpr (fast_printable<T>)
+	{
+		if (plain_stream(os))
+		{
+			render_buffer buffer(os);
+			buffer.append(open);
+			for (It it = first; it != last; ++it)
+			{
+				if (it != first)
+				{
+					buffer.append(sep);
+				}
+				buffer.append_number(*it);
+			}
+			buffer.append(close);
+			buffer.flush();
+			return os;
+		}
+	}
+	// Пустой open не должен забирать ширину поля у первого элемента
+	if (!open.empty())
+	{
+		os << open;
+	}
+	for (It it = first; it != last; ++it)
+	{
+		if (it != first)
+		{
+			os << sep;
+		}
+		os << *it;
+	}
+	return os << close;
+}
+
+#if defined(__cpp_lib_format)
+/// Основа std::formatter контейнеров: спецификация относится к элементам,
+/// std::format("{:x}", v) печатает каждый элемент в hex
+template <typename T, typename CharT>
+struct range_formatter
+{
+	template <typename ParseContext>
+	constexpr typename ParseContext::iterator parse(ParseContext& ctx)
+	{
+		return element_.parse(ctx);
+	}
+
+	template <typename It, typename FormatContext>
+	typename FormatContext::iterator format_range(It first, It last,
+												 std::string_view open,
+												 std::string_view sep,
+												 std::string_view close,
+												 FormatContext& ctx) const
+	{
+		auto out = std::copy(open.begin(), open.end(), ctx.out());
+		for (It it = first; it != last; ++it)
+		{
+			if (it != first)
+			{
+				out = std::copy(sep.begin(), sep.end(), out);
+			}
+			ctx.advance_to(out);
+			out = element_.format(*it, ctx);
+		}
+		return std::copy(close.begin(), close.end(), out);
+	}
+
+   private:
+	std::formatter<T, CharT> element_;
+};
+#endif
+}  // namespace bmstu::detail
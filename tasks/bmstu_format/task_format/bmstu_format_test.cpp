@@ -0,0 +1,114 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <iomanip>
+#include <limits>
+#include <list>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "bmstu_format.h"
+
+namespace
+{
+/// Прежняя печать по элементу - эталон для буферизованной
+template <typename Container>
+std::string reference(const Container& items, std::ostringstream&& os)
+{
+	bool first = true;
+	for (const auto& item : items)
+	{
+		if (!first)
+		{
+			os << ", ";
+		}
+		os << item;
+		first = false;
+	}
+	return os.str();
+}
+
+template <typename Container>
+std::string rendered(const Container& items, std::ostringstream&& os)
+{
+	bmstu::detail::print_range(os, items.begin(), items.end(), "", ", ", "");
+	return os.str();
+}
+
+template <typename Container>
+void expect_same_text(const Container& items)
+{
+	EXPECT_EQ(rendered(items, std::ostringstream()),
+			  reference(items, std::ostringstream()));
+}
+}  // namespace
+
+TEST(PrintRange, MatchesStreamForNumbers)
+{
+	using limits = std::numeric_limits<int>;
+	expect_same_text(std::vector<int>{0, -1, 42, limits::min(), limits::max()});
+	expect_same_text(
+		std::vector<uint64_t>{0, std::numeric_limits<uint64_t>::max()});
+	expect_same_text(std::vector<short>{-7, 7});
+	expect_same_text(std::vector<double>{0.0, -0.0, 0.1, 1.0 / 3, 100000.0,
+										 1234567.0, 1e-5, 1e300, -2.5e-300,
+										 HUGE_VAL, std::nan("")});
+	expect_same_text(std::vector<float>{1.5f, 3.14159265f, 1e10f});
+	expect_same_text(std::vector<long double>{0.1L, 1e4000L});
+	expect_same_text(std::list<bool>{true, false});
+	expect_same_text(std::list<char>{'a', ' ', 'z'});
+	expect_same_text(std::vector<unsigned char>{'x', 'y'});
+	expect_same_text(std::vector<int>{});
+}
+
+TEST(PrintRange, KeepsStreamFormatting)
+{
+	std::vector<int> numbers = {10, 255};
+	std::ostringstream hex;
+	hex << std::hex;
+	EXPECT_EQ(rendered(numbers, std::move(hex)), "a, ff");
+
+	std::vector<double> fractions = {1.0 / 3, 2.0};
+	std::ostringstream precise;
+	precise << std::setprecision(3) << std::fixed;
+	EXPECT_EQ(rendered(fractions, std::move(precise)), "0.333, 2.000");
+
+	std::ostringstream wide;
+	wide << std::setw(4);
+	EXPECT_EQ(rendered(numbers, std::move(wide)), "  10, 255");
+}
+
+TEST(PrintRange, OtherTypesPrintPerElement)
+{
+	std::vector<std::string> words = {"one", "two"};
+	expect_same_text(words);
+	std::ostringstream os;
+	bmstu::detail::print_range(os, words.begin(), words.end(), "{", "|", "}");
+	EXPECT_EQ(os.str(), "{one|two}");
+}
+
+TEST(PrintRange, LargeOutputIsFlushedInChunks)
+{
+	std::vector<int64_t> numbers;
+	for (int64_t i = 0; i < 100000; ++i)
+	{
+		numbers.push_back(i * 1000003 - 50000000000);
+	}
+	expect_same_text(numbers);
+}
+
+TEST(RenderBuffer, WritesOnFlush)
+{
+	std::ostringstream os;
+	bmstu::detail::render_buffer buffer(os);
+	buffer.append("x = ");
+	buffer.append_number(12);
+	buffer.append(';');
+	EXPECT_EQ(buffer.size(), 7u);
+	EXPECT_EQ(os.str(), "");
+	buffer.append(std::string(100000, 'z'));
+	buffer.flush();
+	EXPECT_EQ(buffer.size(), 0u);
+	EXPECT_EQ(os.str(), "x = 12;" + std::string(100000, 'z'));
+}
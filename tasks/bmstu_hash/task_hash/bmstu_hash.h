@@ -0,0 +1,155 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <type_traits>
+
+namespace bmstu
+{
+namespace detail
+{
+/// Константы wyhash
+inline constexpr uint64_t hash_secret[4] = {
+	0x2d358dccaa6c78a5ull, 0x8bb84b93962eacc9ull, 0x4b33a62ed433d4a3ull,
+	0x4d5a2da51de1aa47ull};
+
+/// 64x64 -> 128 умножение, возвращает младшую и старшую половины
+inline void hash_mum(uint64_t& a, uint64_t& b) noexcept
+{
+#if defined(__SIZEOF_INT128__)
+	__uint128_t r = static_cast<__uint128_t>(a) * b;
+	a = static_cast<uint64_t>(r);
+	b = static_cast<uint64_t>(r >> 64);
+#else
+	uint64_t ha = a >> 32, hb = b >> 32, la = static_cast<uint32_t>(a),
+			 lb = static_cast<uint32_t>(b);
+	uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+	uint64_t t = rl + (rm0 << 32);
+	uint64_t c = t < rl;
+	uint64_t lo = t + (rm1 << 32);
+	c += lo < t;
+	uint64_t hi = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+	a = lo;
+	b = hi;
+#endif
+}
+
+inline uint64_t hash_mix(uint64_t a, uint64_t b) noexcept
+{
+	hash_mum(a, b);
+	return a ^ b;
+}
+
+inline uint64_t hash_read8(const unsigned char* p) noexcept
+{
+	uint64_t v;
+	std::memcpy(&v, p, 8);
+	return v;
+}
+
+inline uint64_t hash_read4(const unsigned char* p) noexcept
+{
+	uint32_t v;
+	std::memcpy(&v, p, 4);
+	return v;
+}
+
+inline uint64_t hash_read3(const unsigned char* p, size_t k) noexcept
+{
+	return (static_cast<uint64_t>(p[0]) << 16) |
+		   (static_cast<uint64_t>(p[k >> 1]) << 8) | p[k - 1];
+}
+}  // namespace detail
+
+/// Быстрый некриптографический хеш блока памяти (wyhash)
+inline uint64_t hash_bytes(const void* data, size_t len,
+						   uint64_t seed = 0) noexcept
+{
+	using namespace detail;
+	const auto* p = static_cast<const unsigned char*>(data);
+	seed ^= hash_mix(seed ^ hash_secret[0], hash_secret[1]);
+	uint64_t a = 0;
+	uint64_t b = 0;
+	if (len <= 16)
+	{
+		if (len >= 4)
+		{
+			a = (hash_read4(p) << 32) | hash_read4(p + ((len >> 3) << 2));
+			b = (hash_read4(p + len - 4) << 32) |
+				hash_read4(p + len - 4 - ((len >> 3) << 2));
+		}
+		else if (len > 0)
+		{
+			a = hash_read3(p, len);
+		}
+	}
+	else
+	{
+		size_t i = len;
+		if (i >= 48)
+		{
+			uint64_t see1 = seed;
+			uint64_t see2 = seed;
+			do
+			{
+				seed = hash_mix(hash_read8(p) ^ hash_secret[1],
+								hash_read8(p + 8) ^ seed);
+				see1 = hash_mix(hash_read8(p + 16) ^ hash_secret[2],
+								hash_read8(p + 24) ^ see1);
+				see2 = hash_mix(hash_read8(p + 32) ^ hash_secret[3],
+								hash_read8(p + 40) ^ see2);
+				p += 48;
+				i -= 48;
+			} while (i >= 48);
+			seed ^= see1 ^ see2;
+		}
+		while (i > 16)
+		{
+			seed = hash_mix(hash_read8(p) ^ hash_secret[1],
+							hash_read8(p + 8) ^ seed);
+			i -= 16;
+			p += 16;
+		}
+		a = hash_read8(p + i - 16);
+		b = hash_read8(p + i - 8);
+	}
+	a ^= hash_secret[1];
+	b ^= seed;
+	hash_mum(a, b);
+	return hash_mix(a ^ hash_secret[0] ^ len, b ^ hash_secret[1]);
+}
+
+/// Подмешивает хеш очередного элемента к накопленному
+inline uint64_t hash_combine(uint64_t seed, uint64_t value) noexcept
+{
+	return detail::hash_mix(seed ^ detail::hash_secret[0],
+							value ^ detail::hash_secret[1]);
+}
+
+/// Хеш последовательности: байтами, если у T нет паддингов и разных
+/// представлений одного значения, иначе поэлементно через std::hash<T>
+template <typename T, typename It>
+uint64_t hash_range(It first, It last, size_t count) noexcept
+{
+	uint64_t seed = detail::hash_secret[2] ^ count;
+	for (; first != last; ++first)
+	{
+		seed = hash_combine(seed, std::hash<T>{}(*first));
+	}
+	return seed;
+}
+
+template <typename T>
+uint64_t hash_contiguous(const T* data, size_t count) noexcept
+{
+	if constexpr (std::has_unique_object_representations_v<T>)
+	{
+		return hash_bytes(data, count * sizeof(T));
+	}
+	else
+	{
+		return hash_range<T>(data, data + count, count);
+	}
+}
+}  // namespace bmstu
@@ -0,0 +1,61 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <unordered_set>
+#include <vector>
+#include "bmstu_hash.h"
+
+TEST(HashTest, Deterministic)
+{
+	std::string data = "The quick brown fox jumps over the lazy dog";
+	ASSERT_EQ(bmstu::hash_bytes(data.data(), data.size()),
+			  bmstu::hash_bytes(data.data(), data.size()));
+}
+
+TEST(HashTest, SeedChangesHash)
+{
+	std::string data = "seed";
+	ASSERT_NE(bmstu::hash_bytes(data.data(), data.size(), 0),
+			  bmstu::hash_bytes(data.data(), data.size(), 1));
+}
+
+TEST(HashTest, AllLengthsDistinct)
+{
+	std::string data(200, 'a');
+	std::unordered_set<uint64_t> hashes;
+	for (size_t len = 0; len <= data.size(); ++len)
+	{
+		hashes.insert(bmstu::hash_bytes(data.data(), len));
+	}
+	ASSERT_EQ(hashes.size(), data.size() + 1);
+}
+
+TEST(HashTest, SingleBitFlip)
+{
+	for (size_t len : {1, 3, 4, 8, 16, 17, 47, 48, 49, 100})
+	{
+		std::vector<unsigned char> data(len, 0x5a);
+		uint64_t base = bmstu::hash_bytes(data.data(), len);
+		for (size_t byte = 0; byte < len; ++byte)
+		{
+			data[byte] ^= 1;
+			ASSERT_NE(bmstu::hash_bytes(data.data(), len), base);
+			data[byte] ^= 1;
+		}
+	}
+}
+
+TEST(HashTest, ContiguousMatchesBytes)
+{
+	std::vector<int> data{1, 2, 3, 4, 5};
+	ASSERT_EQ(bmstu::hash_contiguous(data.data(), data.size()),
+			  bmstu::hash_bytes(data.data(), data.size() * sizeof(int)));
+}
+
+TEST(HashTest, ContiguousElementwise)
+{
+	std::vector<double> a{0.0, 1.5};
+	std::vector<double> b{-0.0, 1.5};
+	ASSERT_EQ(bmstu::hash_contiguous(a.data(), a.size()),
+			  bmstu::hash_contiguous(b.data(), b.size()));
+}
@@ -1,29 +1,800 @@
 #include "base_algo_let.h"
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstring>
+#include <functional>
+#include <numeric>
+#include <thread>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define BMSTU_LET_AVX2 1
+#endif
+
+namespace
+{
+using let_detail::kernel_mode;
+
+/// Меньше этого числа элементов на поток запуск потока не окупается
+constexpr size_t parallel_chunk = 1 << 16;
+
+/// Блок, после которого параллельный поиск проверяет, не нашел ли другой поток
+constexpr size_t search_block = 1 << 12;
+
+/// Короче этого radix sort проигрывает std::sort на обнулении гистограмм
+constexpr size_t radix_threshold = 1 << 11;
+
+/// 11-битные разряды: три прохода на 32 бита, гистограмма помещается в L1
+constexpr unsigned radix_bits = 11;
+constexpr unsigned radix_buckets = 1u << radix_bits;
+constexpr unsigned radix_passes = 3;
+
+/// Блок fused_pipeline: 16 КБ вместе с буфером положительных остаются в L1
+constexpr size_t pipeline_block = 1 << 12;
+
+size_t parallel_parts(size_t n)
+{
+	size_t threads = std::max(1u, std::thread::hardware_concurrency());
+	return std::clamp<size_t>(n / parallel_chunk, 1, threads);
+}
+
+/// Делит [0, n) на parts частей и вызывает f(part, first, count) для каждой
+/// в общем пуле; текущий поток выполняет части вместе с ним
+template <typename F>
+void run_parts(size_t n, size_t parts, F f)
+{
+	size_t step = n / parts;
+	if (parts == 1)
+	{
+		f(size_t{0}, size_t{0}, n);
+		return;
+	}
+	bmstu::thread_pool::shared().parallel_for(
+		0, parts,
+		[&](size_t i) { f(i, i * step, i + 1 == parts ? n - i * step : step); },
+		1);
+}
+
+#ifdef BMSTU_LET_AVX2
+/// Для каждой 8-битной маски положительных элементов - индексы, которые
+/// сдвигают их в начало регистра
+struct compact_table
+{
+	alignas(32) uint32_t index[256][8];
+};
+
+constexpr compact_table make_compact_table()
+{
+	compact_table table{};
+	for (unsigned mask = 0; mask < 256; ++mask)
+	{
+		unsigned k = 0;
+		for (unsigned i = 0; i < 8; ++i)
+		{
+			if ((mask >> i) & 1)
+			{
+				table.index[mask][k++] = i;
+			}
+		}
+	}
+	return table;
+}
+
+constexpr compact_table compact_lut = make_compact_table();
+
+unsigned positive_mask(__m256i x)
+{
+	__m256i positive = _mm256_cmpgt_epi32(x, _mm256_setzero_si256());
+	return static_cast<unsigned>(
+		_mm256_movemask_ps(_mm256_castsi256_ps(positive)));
+}
+#endif
+
+size_t count_positive(const int* p, size_t n)
+{
+	size_t count = 0;
+	size_t i = 0;
+#ifdef BMSTU_LET_AVX2
+	for (; i + 8 <= n; i += 8)
+	{
+		__m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+		count += static_cast<size_t>(std::popcount(positive_mask(x)));
+	}
+#endif
+	for (; i < n; ++i)
+	{
+		count += p[i] > 0;
+	}
+	return count;
+}
+
+/// Сжатие потока: положительные элементы p подряд в [out, out_end), места
+/// в приемнике должно хватать. Полная запись регистра идет, пока в нем есть
+/// место под 8 элементов, а хвост пишется без ветвлений до заполнения.
+/// Возвращает конец записанного
+int* compact_positive(const int* p, size_t n, int* out, int* out_end)
+{
+	size_t i = 0;
+#ifdef BMSTU_LET_AVX2
+	for (; i + 8 <= n && out_end - out >= 8; i += 8)
+	{
+		__m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+		unsigned mask = positive_mask(x);
+		__m256i index = _mm256_load_si256(
+			reinterpret_cast<const __m256i*>(compact_lut.index[mask]));
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(out),
+							_mm256_permutevar8x32_epi32(x, index));
+		out += std::popcount(mask);
+	}
+#endif
+	for (; i < n && out != out_end; ++i)
+	{
+		*out = p[i];
+		out += p[i] > 0;
+	}
+	return out;
+}
+
+/// Сумма положительных в 64-битных полосах: каждая полоса переполнится не
+/// раньше чем через 2^32 слагаемых
+int64_t sum_positive(const int* p, size_t n)
+{
+	int64_t sum = 0;
+	size_t i = 0;
+#ifdef BMSTU_LET_AVX2
+	const __m256i zero = _mm256_setzero_si256();
+	__m256i low = zero;
+	__m256i high = zero;
+	for (; i + 8 <= n; i += 8)
+	{
+		__m256i x = _mm256_max_epi32(
+			_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i)), zero);
+		low = _mm256_add_epi64(
+			low, _mm256_cvtepu32_epi64(_mm256_castsi256_si128(x)));
+		high = _mm256_add_epi64(
+			high, _mm256_cvtepu32_epi64(_mm256_extracti128_si256(x, 1)));
+	}
+	alignas(32) int64_t lanes[4];
+	_mm256_store_si256(reinterpret_cast<__m256i*>(lanes),
+					   _mm256_add_epi64(low, high));
+	sum = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+#endif
+	for (; i < n; ++i)
+	{
+		sum += std::max(p[i], 0);
+	}
+	return sum;
+}
+
+/// x делится на 10, если четно и x * 5^-1 mod 2^32 + A <= 2A, где
+/// A = (2^31 - 1) / 5 (делимость знаковых без деления)
+constexpr uint32_t inverse_5 = 0xCCCCCCCDu;
+constexpr uint32_t bias_5 = 429496729u;
+
+bool multiple_of_10(int x)
+{
+	return (x & 1) == 0 &&
+		   static_cast<uint32_t>(x) * inverse_5 + bias_5 <= 2 * bias_5;
+}
+
+bool find_multiple_of_10(const int* p, size_t n)
+{
+	size_t i = 0;
+#ifdef BMSTU_LET_AVX2
+	const __m256i inverse = _mm256_set1_epi32(static_cast<int>(inverse_5));
+	const __m256i bias = _mm256_set1_epi32(static_cast<int>(bias_5));
+	const __m256i sign = _mm256_set1_epi32(INT32_MIN);
+	const __m256i limit =
+		_mm256_set1_epi32(static_cast<int>((2 * bias_5) ^ 0x80000000u));
+	const __m256i one = _mm256_set1_epi32(1);
+	const __m256i zero = _mm256_setzero_si256();
+	for (; i + 8 <= n; i += 8)
+	{
+		__m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+		__m256i t = _mm256_add_epi32(_mm256_mullo_epi32(x, inverse), bias);
+		// Беззнаковое t > limit через знаковое сравнение со сдвигом на 2^31
+		__m256i above = _mm256_cmpgt_epi32(_mm256_xor_si256(t, sign), limit);
+		__m256i even = _mm256_cmpeq_epi32(_mm256_and_si256(x, one), zero);
+		__m256i hit = _mm256_andnot_si256(above, even);
+		if (!_mm256_testz_si256(hit, hit))
+		{
+			return true;
+		}
+	}
+#endif
+	for (; i < n; ++i)
+	{
+		if (multiple_of_10(p[i]))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+/// Простые поэлементные ядра компилятор векторизует сам
+void clamp_negative(int* p, size_t n)
+{
+	for (size_t i = 0; i < n; ++i)
+	{
+		p[i] = std::max(p[i], 0);
+	}
+}
+
+void twice(int* p, size_t n)
+{
+	for (size_t i = 0; i < n; ++i)
+	{
+		p[i] = static_cast<int>(static_cast<uint32_t>(p[i]) << 1);
+	}
+}
+
+/// Место под found новых положительных после done из total элементов.
+/// Резерв под весь вход оставался бы в результате, а подсчет заранее стоил
+/// бы еще одного чтения массива, поэтому емкость растет по доле
+/// положительных в пройденных блоках с запасом 1/16, но не меньше чем в
+/// полтора раза
+void reserve_positives(std::vector<int>& out, size_t found, size_t done,
+					   size_t total)
+{
+	size_t required = out.size() + found;
+	if (required <= out.capacity())
+	{
+		return;
+	}
+	auto projected = static_cast<size_t>(static_cast<double>(required) *
+										 static_cast<double>(total) /
+										 static_cast<double>(done));
+	out.reserve(std::max(projected + projected / 16,
+						 out.capacity() + out.capacity() / 2));
+}
+
+/// Разряд ключа: знаковый бит инвертирован, чтобы отрицательные шли первыми
+unsigned radix_digit(int x, unsigned pass)
+{
+	uint32_t key = static_cast<uint32_t>(x) ^ 0x80000000u;
+	return (key >> (pass * radix_bits)) & (radix_buckets - 1);
+}
+
+using radix_histogram = std::array<size_t, radix_buckets>;
+
+/// Превращает гистограммы частей (в порядке частей) в начальные позиции
+/// записи: корзины идут по возрастанию или убыванию разряда, внутри корзины
+/// части по порядку, так что проход остается устойчивым
+void radix_offsets(std::vector<radix_histogram>& histograms, sort_order order)
+{
+	size_t position = 0;
+	for (unsigned i = 0; i < radix_buckets; ++i)
+	{
+		unsigned bucket =
+			order == sort_order::ascending ? i : radix_buckets - 1 - i;
+		for (radix_histogram& histogram : histograms)
+		{
+			size_t count = histogram[bucket];
+			histogram[bucket] = position;
+			position += count;
+		}
+	}
+}
+
+/// Проход с одной корзиной на весь массив ничего не переставляет
+bool radix_pass_trivial(const std::vector<radix_histogram>& histograms,
+						size_t n)
+{
+	for (unsigned bucket = 0; bucket < radix_buckets; ++bucket)
+	{
+		size_t total = 0;
+		for (const radix_histogram& histogram : histograms)
+		{
+			total += histogram[bucket];
+		}
+		if (total != 0)
+		{
+			return total == n;
+		}
+	}
+	return true;
+}
+
+void radix_sort(std::vector<int>& v, sort_order order, size_t parts)
+{
+	size_t n = v.size();
+	std::vector<int> buffer(n);
+	std::vector<radix_histogram> histograms(parts);
+	// В одном потоке гистограммы всех разрядов собираются за одно чтение:
+	// по всему массиву они не зависят от перестановок предыдущих проходов
+	std::array<radix_histogram, radix_passes> counted{};
+	if (parts == 1)
+	{
+		for (int x : v)
+		{
+			for (unsigned pass = 0; pass < radix_passes; ++pass)
+			{
+				++counted[pass][radix_digit(x, pass)];
+			}
+		}
+	}
+	for (unsigned pass = 0; pass < radix_passes; ++pass)
+	{
+		const int* source = v.data();
+		if (parts == 1)
+		{
+			histograms[0] = counted[pass];
+		}
+		else
+		{
+			run_parts(n, parts,
+					  [&](size_t part, size_t first, size_t count)
+					  {
+						  radix_histogram& histogram = histograms[part];
+						  histogram.fill(0);
+						  for (size_t i = first; i < first + count; ++i)
+						  {
+							  ++histogram[radix_digit(source[i], pass)];
+						  }
+					  });
+		}
+		if (radix_pass_trivial(histograms, n))
+		{
+			continue;
+		}
+		radix_offsets(histograms, order);
+		int* target = buffer.data();
+		run_parts(n, parts,
+				  [&](size_t part, size_t first, size_t count)
+				  {
+					  radix_histogram& offsets = histograms[part];
+					  for (size_t i = first; i < first + count; ++i)
+					  {
+						  target[offsets[radix_digit(source[i], pass)]++] =
+							  source[i];
+					  }
+				  });
+		v.swap(buffer);
+	}
+}
+/// 8 байт имени начиная с offset как число: сравнение чисел совпадает с
+/// лексикографическим сравнением этих байт, короткий хвост добит нулями
+uint64_t name_prefix(std::string_view name, size_t offset = 0)
+{
+	unsigned char bytes[8] = {};
+	if (offset < name.size())
+	{
+		std::memcpy(bytes, name.data() + offset,
+					std::min<size_t>(name.size() - offset, 8));
+	}
+	uint64_t prefix = 0;
+	for (unsigned char byte : bytes)
+	{
+		prefix = (prefix << 8) | byte;
+	}
+	return prefix;
+}
+
+/// Устойчивая сортировка подсчетом индексов по uint8_t-ключу
+std::vector<uint32_t> order_by_age(const uint8_t* ages, size_t n)
+{
+	std::array<size_t, 257> offsets{};
+	for (size_t i = 0; i < n; ++i)
+	{
+		++offsets[ages[i] + 1];
+	}
+	std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+	std::vector<uint32_t> order(n);
+	for (size_t i = 0; i < n; ++i)
+	{
+		order[offsets[ages[i]]++] = static_cast<uint32_t>(i);
+	}
+	return order;
+}
+
+/// Ключ сортировки по имени: 8 байт имени и индекс записи
+struct name_key
+{
+	uint64_t prefix;
+	uint32_t index;
+};
+
+/// Сортирует ключи по 8 байтам имени с позиции depth, затем уточняет
+/// группы равных префиксов следующими 8 байтами. Строки читаются один раз
+/// на уровень, а не в каждом сравнении. Группу, где какое-то имя кончается
+/// внутри окна, нули добивки не отличают от символов '\0', поэтому она
+/// досортировывается полным сравнением
+template <typename Name>
+void sort_name_keys(name_key* first, name_key* last, size_t depth, Name name)
+{
+	std::sort(first, last,
+			  [](const name_key& a, const name_key& b)
+			  {
+				  return a.prefix != b.prefix ? a.prefix < b.prefix
+											  : a.index < b.index;
+			  });
+	size_t next = depth + 8;
+	for (name_key* run = first; run != last;)
+	{
+		name_key* end = run + 1;
+		bool finished = name(run->index).size() <= next;
+		for (; end != last && end->prefix == run->prefix; ++end)
+		{
+			finished |= name(end->index).size() <= next;
+		}
+		if (end - run > 1)
+		{
+			if (finished)
+			{
+				std::sort(run, end,
+						  [&](const name_key& a, const name_key& b)
+						  {
+							  int cmp = name(a.index).compare(name(b.index));
+							  return cmp != 0 ? cmp < 0 : a.index < b.index;
+						  });
+			}
+			else
+			{
+				for (name_key* key = run; key != end; ++key)
+				{
+					key->prefix = name_prefix(name(key->index), next);
+				}
+				sort_name_keys(run, end, next, name);
+			}
+		}
+		run = end;
+	}
+}
+
+template <typename Name>
+std::vector<uint32_t> order_by_name(const uint64_t* prefixes, size_t n,
+									Name name)
+{
+	std::vector<name_key> keys(n);
+	for (size_t i = 0; i < n; ++i)
+	{
+		keys[i] = {prefixes[i], static_cast<uint32_t>(i)};
+	}
+	sort_name_keys(keys.data(), keys.data() + n, 0, name);
+	std::vector<uint32_t> order(n);
+	for (size_t i = 0; i < n; ++i)
+	{
+		order[i] = keys[i].index;
+	}
+	return order;
+}
+
+template <typename T>
+void gather(std::vector<T>& values, const std::vector<uint32_t>& order)
+{
+	std::vector<T> sorted(values.size());
+	for (size_t i = 0; i < order.size(); ++i)
+	{
+		sorted[i] = values[order[i]];
+	}
+	values.swap(sorted);
+}
+}  // namespace
+
+namespace let_detail
+{
+void apply_order(std::vector<Student>& v, const std::vector<uint32_t>& order)
+{
+	std::vector<Student> sorted;
+	sorted.reserve(v.size());
+	for (uint32_t index : order)
+	{
+		sorted.push_back(std::move(v[index]));
+	}
+	v.swap(sorted);
+}
+
+std::vector<int> positive_numbers(const std::vector<int>& v, kernel_mode mode)
+{
+	std::vector<int> result;
+	if (mode == kernel_mode::scalar)
+	{
+		for (int x : v)
+		{
+			if (x > 0)
+			{
+				result.push_back(x);
+			}
+		}
+		return result;
+	}
+	size_t parts = mode == kernel_mode::parallel ? parallel_parts(v.size()) : 1;
+	std::vector<size_t> offsets(parts + 1);
+	run_parts(v.size(), parts,
+			  [&](size_t part, size_t first, size_t count)
+			  { offsets[part + 1] = count_positive(v.data() + first, count); });
+	for (size_t i = 0; i < parts; ++i)
+	{
+		offsets[i + 1] += offsets[i];
+	}
+	result.resize(offsets[parts]);
+	run_parts(v.size(), parts,
+			  [&](size_t part, size_t first, size_t count)
+			  {
+				  compact_positive(v.data() + first, count,
+								   result.data() + offsets[part],
+								   result.data() + offsets[part + 1]);
+			  });
+	return result;
+}
+
+int64_t sum_positive_numbers(const std::vector<int>& v, kernel_mode mode)
+{
+	if (mode == kernel_mode::scalar)
+	{
+		int64_t sum = 0;
+		for (int x : v)
+		{
+			if (x > 0)
+			{
+				sum += x;
+			}
+		}
+		return sum;
+	}
+	size_t parts = mode == kernel_mode::parallel ? parallel_parts(v.size()) : 1;
+	std::vector<int64_t> sums(parts);
+	run_parts(v.size(), parts,
+			  [&](size_t part, size_t first, size_t count)
+			  { sums[part] = sum_positive(v.data() + first, count); });
+	int64_t sum = 0;
+	for (int64_t part : sums)
+	{
+		sum += part;
+	}
+	return sum;
+}
+
+bool is_divisible_by_10(const std::vector<int>& v, kernel_mode mode)
+{
+	if (mode == kernel_mode::scalar)
+	{
+		for (int x : v)
+		{
+			if (x % 10 == 0)
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+	if (mode == kernel_mode::simd)
+	{
+		return find_multiple_of_10(v.data(), v.size());
+	}
+	std::atomic<bool> found = false;
+	auto scan = [&](size_t, size_t first, size_t count)
+	{
+		for (size_t i = 0; i < count; i += search_block)
+		{
+			if (found.load(std::memory_order_relaxed))
+			{
+				return;
+			}
+			size_t block = std::min(search_block, count - i);
+			if (find_multiple_of_10(v.data() + first + i, block))
+			{
+				found.store(true, std::memory_order_relaxed);
+				return;
+			}
+		}
+	};
+	run_parts(v.size(), parallel_parts(v.size()), scan);
+	return found.load();
+}
+
+void replace_negative_numbers(std::vector<int>& v, kernel_mode mode)
+{
+	size_t parts = mode == kernel_mode::parallel ? parallel_parts(v.size()) : 1;
+	run_parts(v.size(), parts, [&](size_t, size_t first, size_t count)
+			  { clamp_negative(v.data() + first, count); });
+}
+
+void double_values(std::vector<int>& v, kernel_mode mode)
+{
+	size_t parts = mode == kernel_mode::parallel ? parallel_parts(v.size()) : 1;
+	run_parts(v.size(), parts, [&](size_t, size_t first, size_t count)
+			  { twice(v.data() + first, count); });
+}
+void sort_positive_numbers(std::vector<int>& v, sort_order order,
+						   kernel_mode mode)
+{
+	if (mode == kernel_mode::scalar || v.size() < radix_threshold)
+	{
+		if (order == sort_order::ascending)
+		{
+			std::sort(v.begin(), v.end());
+		}
+		else
+		{
+			std::sort(v.begin(), v.end(), std::greater<>());
+		}
+		return;
+	}
+	// Уже упорядоченный вход radix sort не ускоряет, а проверка на
+	// случайных данных обрывается на первых элементах
+	auto ascending = [](int a, int b) { return a < b; };
+	auto descending = [](int a, int b) { return a > b; };
+	bool want_ascending = order == sort_order::ascending;
+	if (want_ascending ? std::is_sorted(v.begin(), v.end(), ascending)
+					   : std::is_sorted(v.begin(), v.end(), descending))
+	{
+		return;
+	}
+	if (want_ascending ? std::is_sorted(v.begin(), v.end(), descending)
+					   : std::is_sorted(v.begin(), v.end(), ascending))
+	{
+		std::reverse(v.begin(), v.end());
+		return;
+	}
+	radix_sort(v, order,
+			   mode == kernel_mode::parallel ? parallel_parts(v.size()) : 1);
+}
+}  // namespace let_detail
+
+fused_pipeline& fused_pipeline::add(step s)
+{
+	if ((s == step::positives || s == step::sum) &&
+		std::find(steps_.begin(), steps_.end(), s) != steps_.end())
+	{
+		throw std::invalid_argument("Pipeline step can be collected once");
+	}
+	steps_.push_back(s);
+	return *this;
+}
+
+pipeline_result fused_pipeline::run(std::vector<int>& v) const
+{
+	pipeline_result result;
+	int buffer[pipeline_block];
+	for (size_t first = 0; first < v.size(); first += pipeline_block)
+	{
+		int* block = v.data() + first;
+		size_t count = std::min(pipeline_block, v.size() - first);
+		for (step s : steps_)
+		{
+			switch (s)
+			{
+				case step::replace_negative:
+					clamp_negative(block, count);
+					break;
+				case step::double_values:
+					twice(block, count);
+					break;
+				case step::positives:
+				{
+					int* end = compact_positive(block, count, buffer,
+												buffer + pipeline_block);
+					reserve_positives(result.positives,
+									  static_cast<size_t>(end - buffer),
+									  first + count, v.size());
+					result.positives.insert(result.positives.end(), buffer,
+											end);
+					break;
+				}
+				case step::sum:
+					result.sum += sum_positive(block, count);
+					break;
+			}
+		}
+	}
+	return result;
+}
 
 std::vector<int> positive_numbers(const std::vector<int>& v)
 {
-	return {};
+	return let_detail::positive_numbers(v, kernel_mode::simd);
+}
+void sort_positive_numbers(std::vector<int>& v)
+{
+	let_detail::sort_positive_numbers(v, sort_order::ascending,
+									  kernel_mode::simd);
+}
+void sort_positive_numbers(std::vector<int>& v, sort_order order)
+{
+	let_detail::sort_positive_numbers(v, order, kernel_mode::simd);
 }
-void sort_positive_numbers(std::vector<int>& v) {}
-int sum_positive_numbers(const std::vector<int>& v)
+int64_t sum_positive_numbers(const std::vector<int>& v)
 {
-	return 0;
+	return let_detail::sum_positive_numbers(v, kernel_mode::simd);
 }
 bool is_divisible_by_10(const std::vector<int>& v)
 {
-	return false;
+	return let_detail::is_divisible_by_10(v, kernel_mode::simd);
 }
 void replace_negative_numbers(std::vector<int>& v)
 {
-	return;
+	let_detail::replace_negative_numbers(v, kernel_mode::simd);
 }
 void double_values(std::vector<int>& v)
 {
-	return;
+	let_detail::double_values(v, kernel_mode::simd);
 }
 void sort_students_by_age(std::vector<Student>& v)
 {
-	return;
+	std::vector<uint8_t> ages(v.size());
+	for (size_t i = 0; i < v.size(); ++i)
+	{
+		ages[i] = v[i].age;
+	}
+	let_detail::apply_order(v, order_by_age(ages.data(), ages.size()));
+}
+void sort_students_by_name(std::vector<Student>& v)
+{
+	std::vector<uint64_t> prefixes(v.size());
+	for (size_t i = 0; i < v.size(); ++i)
+	{
+		prefixes[i] = name_prefix(v[i].name);
+	}
+	std::vector<uint32_t> order =
+		order_by_name(prefixes.data(), prefixes.size(),
+					  [&](uint32_t i) -> std::string_view
+					  { return v[i].name; });
+	let_detail::apply_order(v, order);
+}
+
+StudentTable::StudentTable(const std::vector<Student>& students)
+{
+	size_t name_bytes = 0;
+	for (const Student& student : students)
+	{
+		name_bytes += student.name.size();
+	}
+	reserve(students.size(), name_bytes);
+	for (const Student& student : students)
+	{
+		push_back(student.name, student.age);
+	}
+}
+
+void StudentTable::reserve(size_t count, size_t name_bytes)
+{
+	ages_.reserve(count);
+	name_prefixes_.reserve(count);
+	name_offsets_.reserve(count);
+	name_lengths_.reserve(count);
+	names_.reserve(name_bytes);
+}
+
+void StudentTable::push_back(std::string_view name, uint8_t age)
+{
+	ages_.push_back(age);
+	name_prefixes_.push_back(name_prefix(name));
+	name_offsets_.push_back(names_.size());
+	name_lengths_.push_back(static_cast<uint32_t>(name.size()));
+	names_.append(name);
+}
+
+void StudentTable::sort_by_age()
+{
+	apply_(order_by_age(ages_.data(), ages_.size()));
+}
+
+void StudentTable::sort_by_name()
+{
+	apply_(order_by_name(name_prefixes_.data(), name_prefixes_.size(),
+						 [this](uint32_t i) { return name(i); }));
+}
+
+std::vector<Student> StudentTable::to_students() const
+{
+	std::vector<Student> students;
+	students.reserve(size());
+	for (size_t i = 0; i < size(); ++i)
+	{
+		students.emplace_back("", ages_[i]);
+		students.back().name.assign(name(i));
+	}
+	return students;
+}
+
+void StudentTable::apply_(const std::vector<uint32_t>& order)
+{
+	gather(ages_, order);
+	gather(name_prefixes_, order);
+	gather(name_offsets_, order);
+	gather(name_lengths_, order);
 }
-void sort_students_by_name(std::vector<Student>& v) {}
\ No newline at end of file
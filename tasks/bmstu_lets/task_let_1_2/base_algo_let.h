@@ -1,7 +1,16 @@
 #pragma once
+#include <concepts>
 #include <cstdint>
+#include <execution>
+#include <numeric>
+#include <stdexcept>
 #include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
 #include <vector>
+#include "parallel_sort.h"
+#include "thread_pool.h"
 
 /*
 1. Сохранить в отдельный массив только положительные числа из исходного массива.
@@ -25,11 +34,313 @@ struct Student
 	uint8_t age;
 	std::string name;
 };
+enum class sort_order
+{
+	ascending,
+	descending
+};
+
 std::vector<int> positive_numbers(const std::vector<int>& v);
+/// LSD radix sort по 11-битным разрядам, короткие массивы - std::sort
 void sort_positive_numbers(std::vector<int>& v);
-int sum_positive_numbers(const std::vector<int>& v);
+void sort_positive_numbers(std::vector<int>& v, sort_order order);
+/// Сумма копится в 64 битах, поэтому не переполняется на больших массивах
+int64_t sum_positive_numbers(const std::vector<int>& v);
 bool is_divisible_by_10(const std::vector<int>& v);
 void replace_negative_numbers(std::vector<int>& v);
+/// Удвоение с переносом по модулю 2^32 вместо UB при переполнении
 void double_values(std::vector<int>& v);
+/// Устойчивая сортировка по ключу: ключи (возраст или 8-байтный префикс
+/// имени) и индексы сортируются отдельно от записей, а записи переносятся
+/// один раз по готовой перестановке
 void sort_students_by_age(std::vector<Student>& v);
 void sort_students_by_name(std::vector<Student>& v);
+
+/// Студенты в виде структуры массивов: возрасты, префиксы имен и ссылки на
+/// имена лежат плотно, символы всех имен - в одном буфере. Сортировка
+/// переставляет только плотные массивы
+class StudentTable
+{
+   public:
+	StudentTable() = default;
+	explicit StudentTable(const std::vector<Student>& students);
+
+	void reserve(size_t count, size_t name_bytes = 0);
+	void push_back(std::string_view name, uint8_t age);
+
+	size_t size() const noexcept { return ages_.size(); }
+	uint8_t age(size_t i) const noexcept { return ages_[i]; }
+	std::string_view name(size_t i) const noexcept
+	{
+		return {names_.data() + name_offsets_[i], name_lengths_[i]};
+	}
+
+	void sort_by_age();
+	void sort_by_name();
+
+	std::vector<Student> to_students() const;
+
+   private:
+	void apply_(const std::vector<uint32_t>& order);
+
+	std::vector<uint8_t> ages_;
+	std::vector<uint64_t> name_prefixes_;
+	std::vector<size_t> name_offsets_;
+	std::vector<uint32_t> name_lengths_;
+	std::string names_;
+};
+
+namespace let_detail
+{
+/// Как выполнять ядро: простым циклом, векторно (AVX2, если он включен при
+/// сборке) или векторно по частям в нескольких потоках
+enum class kernel_mode
+{
+	scalar,
+	simd,
+	parallel
+};
+
+template <typename Policy>
+constexpr kernel_mode mode_of()
+{
+	using P = std::remove_cvref_t<Policy>;
+	if constexpr (std::is_same_v<P, std::execution::sequenced_policy>)
+	{
+		return kernel_mode::scalar;
+	}
+	else if constexpr (std::is_same_v<P, std::execution::unsequenced_policy>)
+	{
+		return kernel_mode::simd;
+	}
+	else
+	{
+		return kernel_mode::parallel;
+	}
+}
+
+template <typename Policy>
+concept execution_policy =
+	std::is_execution_policy_v<std::remove_cvref_t<Policy>>;
+
+std::vector<int> positive_numbers(const std::vector<int>& v, kernel_mode mode);
+int64_t sum_positive_numbers(const std::vector<int>& v, kernel_mode mode);
+bool is_divisible_by_10(const std::vector<int>& v, kernel_mode mode);
+void replace_negative_numbers(std::vector<int>& v, kernel_mode mode);
+void double_values(std::vector<int>& v, kernel_mode mode);
+void sort_positive_numbers(std::vector<int>& v, sort_order order,
+						   kernel_mode mode);
+/// Переносит каждого студента один раз: v[i] = старый v[order[i]]
+void apply_order(std::vector<Student>& v, const std::vector<uint32_t>& order);
+}  // namespace let_detail
+
+/// Результат fused_pipeline::run
+struct pipeline_result
+{
+	std::vector<int> positives;
+	int64_t sum = 0;
+};
+
+/// Цепочка операций над массивом за один проход: массив обрабатывается
+/// блоками, помещающимися в L1, и все шаги применяются к блоку по порядку,
+/// пока он в кеше. Например,
+/// fused_pipeline().replace_negative().double_values().positives().sum()
+class fused_pipeline
+{
+   public:
+	enum class step
+	{
+		replace_negative,
+		double_values,
+		positives,
+		sum
+	};
+
+	/// Заменить отрицательные нулями (на месте)
+	fused_pipeline& replace_negative() { return add(step::replace_negative); }
+	/// Удвоить значения (на месте)
+	fused_pipeline& double_values() { return add(step::double_values); }
+	/// Собрать положительные значения на этом шаге в result.positives
+	fused_pipeline& positives() { return add(step::positives); }
+	/// Сложить положительные значения на этом шаге в result.sum
+	fused_pipeline& sum() { return add(step::sum); }
+
+	fused_pipeline& add(step s);
+
+	pipeline_result run(std::vector<int>& v) const;
+
+   private:
+	std::vector<step> steps_;
+};
+
+/// Версии с политикой выполнения: seq - простой цикл, unseq - SIMD,
+/// par и par_unseq - SIMD по частям в общем пуле
+/// (thread_pool::shared().parallel_for). Для сортировки seq - std::sort,
+/// unseq - radix sort, par - radix sort с гистограммами по частям
+template <let_detail::execution_policy Policy>
+std::vector<int> positive_numbers(Policy&&, const std::vector<int>& v)
+{
+	return let_detail::positive_numbers(v, let_detail::mode_of<Policy>());
+}
+
+template <let_detail::execution_policy Policy>
+int64_t sum_positive_numbers(Policy&&, const std::vector<int>& v)
+{
+	return let_detail::sum_positive_numbers(v, let_detail::mode_of<Policy>());
+}
+
+template <let_detail::execution_policy Policy>
+bool is_divisible_by_10(Policy&&, const std::vector<int>& v)
+{
+	return let_detail::is_divisible_by_10(v, let_detail::mode_of<Policy>());
+}
+
+template <let_detail::execution_policy Policy>
+void replace_negative_numbers(Policy&&, std::vector<int>& v)
+{
+	let_detail::replace_negative_numbers(v, let_detail::mode_of<Policy>());
+}
+
+template <let_detail::execution_policy Policy>
+void double_values(Policy&&, std::vector<int>& v)
+{
+	let_detail::double_values(v, let_detail::mode_of<Policy>());
+}
+
+template <let_detail::execution_policy Policy>
+void sort_positive_numbers(Policy&&, std::vector<int>& v,
+						   sort_order order = sort_order::ascending)
+{
+	let_detail::sort_positive_numbers(v, order, let_detail::mode_of<Policy>());
+}
+
+/// Ключи сравнения студентов для sort_students: трехстороннее сравнение,
+/// отрицательное - a раньше b. Составляются по порядку, следующий ключ
+/// решает только при равенстве предыдущих: sort_students(v, by_name,
+/// then_by_age)
+struct student_name_key
+{
+	int operator()(const Student& a, const Student& b) const noexcept
+	{
+		return a.name.compare(b.name);
+	}
+};
+
+struct student_age_key
+{
+	int operator()(const Student& a, const Student& b) const noexcept
+	{
+		return static_cast<int>(a.age) - static_cast<int>(b.age);
+	}
+};
+
+template <typename Key>
+struct descending_key
+{
+	Key key;
+
+	int operator()(const Student& a, const Student& b) const
+	{
+		return key(b, a);
+	}
+};
+
+inline constexpr student_name_key by_name{};
+inline constexpr student_age_key by_age{};
+inline constexpr student_name_key then_by_name{};
+inline constexpr student_age_key then_by_age{};
+
+/// Тот же ключ в обратном порядке: sort_students(v, descending(by_age))
+template <typename Key>
+constexpr descending_key<Key> descending(Key key)
+{
+	return {key};
+}
+
+template <typename Key>
+concept student_key =
+	std::is_invocable_r_v<int, const Key&, const Student&, const Student&>;
+
+namespace let_detail
+{
+/// Сравнение индексов студентов по цепочке ключей
+template <typename... Keys>
+struct student_less
+{
+	const Student* students;
+	std::tuple<Keys...> keys;
+
+	int compare(uint32_t a, uint32_t b) const
+	{
+		int result = 0;
+		std::apply(
+			[&](const Keys&... key)
+			{
+				((result = result != 0 ? result
+									   : key(students[a], students[b])),
+				 ...);
+			},
+			keys);
+		return result;
+	}
+
+	bool operator()(uint32_t a, uint32_t b) const { return compare(a, b) < 0; }
+};
+
+/// То же, но равные по ключам упорядочены по исходной позиции
+template <typename... Keys>
+struct student_total_less
+{
+	student_less<Keys...> less;
+
+	bool operator()(uint32_t a, uint32_t b) const
+	{
+		int result = less.compare(a, b);
+		return result != 0 ? result < 0 : a < b;
+	}
+};
+
+inline std::vector<uint32_t> identity_order(size_t n)
+{
+	std::vector<uint32_t> order(n);
+	std::iota(order.begin(), order.end(), 0u);
+	return order;
+}
+}  // namespace let_detail
+
+/// Устойчивая сортировка по цепочке ключей в пуле потоков: сортируются
+/// индексы параллельным слиянием, студенты переносятся один раз в конце
+template <student_key... Keys>
+void sort_students(bmstu::thread_pool& pool, std::vector<Student>& v,
+				   Keys... keys)
+{
+	std::vector<uint32_t> order = let_detail::identity_order(v.size());
+	let_detail::parallel_stable_sort(
+		pool, order, let_detail::student_less<Keys...>{v.data(), {keys...}});
+	let_detail::apply_order(v, order);
+}
+
+template <student_key... Keys>
+void sort_students(std::vector<Student>& v, Keys... keys)
+{
+	sort_students(bmstu::thread_pool::shared(), v, keys...);
+}
+
+/// Первые k студентов - те же, что после sort_students, и в том же порядке;
+/// порядок остальных не задан
+template <student_key... Keys>
+void partial_sort_students(bmstu::thread_pool& pool, std::vector<Student>& v,
+						   size_t k, Keys... keys)
+{
+	std::vector<uint32_t> order = let_detail::identity_order(v.size());
+	let_detail::parallel_top_k(
+		pool, order, k,
+		let_detail::student_total_less<Keys...>{{v.data(), {keys...}}});
+	let_detail::apply_order(v, order);
+}
+
+template <student_key... Keys>
+void partial_sort_students(std::vector<Student>& v, size_t k, Keys... keys)
+{
+	partial_sort_students(bmstu::thread_pool::shared(), v, k, keys...);
+}
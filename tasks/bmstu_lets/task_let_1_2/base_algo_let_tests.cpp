@@ -1,5 +1,9 @@
 #include "gtest/gtest.h"
 
+#include <algorithm>
+#include <climits>
+#include <functional>
+#include <random>
 #include "base_algo_let.h"
 
 TEST(BaseAlgoLet, PositiveNumbers)
@@ -64,4 +68,298 @@ TEST(BaseAlgoLet, SortStudentsByName)
 		{"Alice", 20}, {"Bob", 18}, {"Charlie", 22}};
 	sort_students_by_name(v);
 	ASSERT_EQ(v, expected);
-}
\ No newline at end of file
+}
+namespace
+{
+std::vector<int> random_numbers(size_t size, uint32_t seed)
+{
+	std::mt19937 rng(seed);
+	std::vector<int> v(size);
+	for (int& x : v)
+	{
+		x = static_cast<int>(rng());
+	}
+	return v;
+}
+}  // namespace
+
+TEST(BaseAlgoLet, PositiveNumbersPolicies)
+{
+	for (size_t size : {0u, 7u, 8u, 1000u, 300000u})
+	{
+		std::vector<int> v = random_numbers(size, static_cast<uint32_t>(size));
+		std::vector<int> expected = positive_numbers(std::execution::seq, v);
+		ASSERT_EQ(positive_numbers(std::execution::unseq, v), expected);
+		ASSERT_EQ(positive_numbers(std::execution::par, v), expected);
+		ASSERT_EQ(positive_numbers(v), expected);
+	}
+}
+
+TEST(BaseAlgoLet, SumPositiveNumbersWide)
+{
+	std::vector<int> v(300001, INT_MAX);
+	v[5] = INT_MIN;
+	int64_t expected = static_cast<int64_t>(INT_MAX) * 300000;
+	ASSERT_EQ(sum_positive_numbers(std::execution::seq, v), expected);
+	ASSERT_EQ(sum_positive_numbers(std::execution::unseq, v), expected);
+	ASSERT_EQ(sum_positive_numbers(std::execution::par_unseq, v), expected);
+	ASSERT_EQ(sum_positive_numbers(v), expected);
+}
+
+TEST(BaseAlgoLet, IsDivisibleBy10Policies)
+{
+	std::vector<int> v(300000, 7);
+	v[3] = INT_MIN;
+	v[4] = INT_MAX;
+	v[5] = -2147483646;
+	ASSERT_FALSE(is_divisible_by_10(std::execution::seq, v));
+	ASSERT_FALSE(is_divisible_by_10(std::execution::unseq, v));
+	ASSERT_FALSE(is_divisible_by_10(std::execution::par, v));
+	for (int hit : {0, -10, 2147483640, -2147483640})
+	{
+		v[v.size() - 3] = hit;
+		ASSERT_TRUE(is_divisible_by_10(std::execution::seq, v));
+		ASSERT_TRUE(is_divisible_by_10(std::execution::unseq, v));
+		ASSERT_TRUE(is_divisible_by_10(std::execution::par, v));
+	}
+}
+
+TEST(BaseAlgoLet, InPlacePolicies)
+{
+	std::vector<int> v = random_numbers(300000, 1);
+	std::vector<int> expected = v;
+	replace_negative_numbers(std::execution::seq, expected);
+	double_values(std::execution::seq, expected);
+	std::vector<int> parallel = v;
+	replace_negative_numbers(std::execution::par, parallel);
+	double_values(std::execution::par, parallel);
+	ASSERT_EQ(parallel, expected);
+	replace_negative_numbers(v);
+	double_values(v);
+	ASSERT_EQ(v, expected);
+}
+
+TEST(BaseAlgoLet, FusedPipeline)
+{
+	std::vector<int> v = random_numbers(100003, 2);
+	std::vector<int> expected = v;
+	replace_negative_numbers(expected);
+	double_values(expected);
+	std::vector<int> expected_positives = positive_numbers(expected);
+	int64_t expected_sum = sum_positive_numbers(expected);
+
+	pipeline_result result = fused_pipeline()
+								 .replace_negative()
+								 .double_values()
+								 .positives()
+								 .sum()
+								 .run(v);
+	ASSERT_EQ(v, expected);
+	ASSERT_EQ(result.positives, expected_positives);
+	ASSERT_EQ(result.sum, expected_sum);
+}
+
+TEST(BaseAlgoLet, FusedPipelineOrder)
+{
+	std::vector<int> v = {-3, 1, 1 << 30, 5};
+	pipeline_result result =
+		fused_pipeline().positives().double_values().sum().run(v);
+	std::vector<int> expected_positives = {1, 1 << 30, 5};
+	ASSERT_EQ(result.positives, expected_positives);
+	ASSERT_EQ(result.sum, 12);
+	std::vector<int> negatives(100000, -1);
+	negatives[7] = 3;
+	pipeline_result few = fused_pipeline().positives().run(negatives);
+	ASSERT_EQ(few.positives, std::vector<int>{3});
+	// Резерв под весь вход не остается в результате
+	ASSERT_LT(few.positives.capacity(), negatives.size() / 2);
+	ASSERT_THROW(fused_pipeline().sum().sum(), std::invalid_argument);
+}
+
+TEST(BaseAlgoLet, SortPositiveNumbersRadix)
+{
+	for (size_t size : {5u, 1000u, 5000u, 300000u})
+	{
+		std::vector<int> v = random_numbers(size, static_cast<uint32_t>(size));
+		for (size_t i = 0; i < size; i += 3)
+		{
+			v[i] &= 0xFFFF;
+		}
+		std::vector<int> ascending = v;
+		std::sort(ascending.begin(), ascending.end());
+		std::vector<int> descending(ascending.rbegin(), ascending.rend());
+		for (auto order : {sort_order::ascending, sort_order::descending})
+		{
+			const auto& expected =
+				order == sort_order::ascending ? ascending : descending;
+			std::vector<int> radix = v;
+			sort_positive_numbers(radix, order);
+			ASSERT_EQ(radix, expected);
+			std::vector<int> parallel = v;
+			sort_positive_numbers(std::execution::par, parallel, order);
+			ASSERT_EQ(parallel, expected);
+		}
+	}
+}
+
+TEST(BaseAlgoLet, SortPositiveNumbersNarrowRange)
+{
+	std::vector<int> v(5000);
+	for (size_t i = 0; i < v.size(); ++i)
+	{
+		v[i] = static_cast<int>((i * 7919) % 100);
+	}
+	std::vector<int> expected = v;
+	std::sort(expected.begin(), expected.end(), std::greater<>());
+	sort_positive_numbers(v, sort_order::descending);
+	ASSERT_EQ(v, expected);
+}
+
+namespace
+{
+std::vector<Student> random_students(size_t size)
+{
+	static const char* names[] = {"Alexandra",	 "Alexander", "Alex", "Bob",
+								  "Charlie",	 "Charlotte", "",	  "Zoe",
+								  "Alexandrina", "Bo"};
+	std::mt19937 rng(5);
+	std::vector<Student> students;
+	for (size_t i = 0; i < size; ++i)
+	{
+		students.emplace_back(names[rng() % 10], static_cast<int>(rng() % 256));
+	}
+	return students;
+}
+}  // namespace
+
+TEST(BaseAlgoLet, SortStudentsStable)
+{
+	std::vector<Student> v = random_students(5000);
+	std::vector<Student> by_age = v;
+	std::stable_sort(by_age.begin(), by_age.end(),
+					 [](const Student& a, const Student& b)
+					 { return a.age < b.age; });
+	std::vector<Student> by_name = by_age;
+	std::stable_sort(by_name.begin(), by_name.end(),
+					 [](const Student& a, const Student& b)
+					 { return a.name < b.name; });
+
+	sort_students_by_age(v);
+	ASSERT_EQ(v, by_age);
+	sort_students_by_name(v);
+	ASSERT_EQ(v, by_name);
+}
+
+TEST(BaseAlgoLet, StudentTable)
+{
+	std::vector<Student> v = random_students(3000);
+	StudentTable table(v);
+	ASSERT_EQ(table.size(), v.size());
+	ASSERT_EQ(table.name(7), v[7].name);
+	ASSERT_EQ(table.age(7), v[7].age);
+
+	sort_students_by_age(v);
+	table.sort_by_age();
+	ASSERT_EQ(table.to_students(), v);
+	sort_students_by_name(v);
+	table.sort_by_name();
+	ASSERT_EQ(table.to_students(), v);
+}
+
+TEST(BaseAlgoLet, SortStudentsByNameEmbeddedZero)
+{
+	std::vector<Student> v = {{"", 1}, {"", 2}, {"", 3}, {"", 4}};
+	v[0].name = std::string("Alexandr\0x", 10);
+	v[1].name = std::string("ab\0", 3);
+	v[2].name = "ab";
+	v[3].name = std::string("Alexandr\0", 9);
+	std::vector<Student> expected = {v[3], v[0], v[2], v[1]};
+	sort_students_by_name(v);
+	ASSERT_EQ(v, expected);
+}
+
+TEST(BaseAlgoLet, SortStudentsMultiKey)
+{
+	std::vector<Student> v = random_students(100000);
+	auto name_then_age = [](const Student& a, const Student& b)
+	{ return a.name != b.name ? a.name < b.name : a.age < b.age; };
+	auto name_only = [](const Student& a, const Student& b)
+	{ return a.name < b.name; };
+	auto age_down_then_name = [](const Student& a, const Student& b)
+	{ return a.age != b.age ? a.age > b.age : a.name < b.name; };
+
+	bmstu::thread_pool pool(4);
+	for (auto [cmp, sort] :
+		 {std::pair<std::function<bool(const Student&, const Student&)>,
+					std::function<void(std::vector<Student>&)>>{
+			  name_then_age,
+			  [&](std::vector<Student>& s)
+			  { sort_students(pool, s, by_name, then_by_age); }},
+		  {name_only,
+		   [&](std::vector<Student>& s) { sort_students(pool, s, by_name); }},
+		  {age_down_then_name, [&](std::vector<Student>& s)
+		   { sort_students(pool, s, descending(by_age), then_by_name); }}})
+	{
+		std::vector<Student> expected = v;
+		std::stable_sort(expected.begin(), expected.end(), cmp);
+		std::vector<Student> sorted = v;
+		sort(sorted);
+		ASSERT_EQ(sorted, expected);
+	}
+
+	std::vector<Student> small = random_students(100);
+	std::vector<Student> expected = small;
+	std::stable_sort(expected.begin(), expected.end(), name_then_age);
+	sort_students(small, by_name, then_by_age);
+	ASSERT_EQ(small, expected);
+}
+
+TEST(BaseAlgoLet, SortStudentsInsidePoolTask)
+{
+	std::vector<Student> v = random_students(200000);
+	std::vector<Student> expected = v;
+	std::stable_sort(expected.begin(), expected.end(),
+					 [](const Student& a, const Student& b)
+					 { return a.name < b.name; });
+	// Каждая задача ждет свои куски, занимая рабочий поток
+	bmstu::thread_pool pool(2);
+	std::vector<Student> first = v;
+	std::vector<Student> second = v;
+	std::vector<Student> top = v;
+	auto a = pool.submit([&] { sort_students(pool, first, by_name); });
+	auto b = pool.submit([&] { sort_students(pool, second, by_name); });
+	auto c =
+		pool.submit([&] { partial_sort_students(pool, top, 100, by_name); });
+	a.get();
+	b.get();
+	c.get();
+	ASSERT_EQ(first, expected);
+	ASSERT_EQ(second, expected);
+	ASSERT_TRUE(std::equal(top.begin(), top.begin() + 100, expected.begin()));
+}
+
+TEST(BaseAlgoLet, PartialSortStudents)
+{
+	std::vector<Student> v = random_students(100000);
+	// Уникальные имена с конца массива проверяют устойчивость отбора
+	for (size_t i = 0; i < v.size(); i += 7)
+	{
+		v[i].name += std::to_string(i);
+	}
+	std::vector<Student> expected = v;
+	std::stable_sort(expected.begin(), expected.end(),
+					 [](const Student& a, const Student& b)
+					 { return a.age < b.age; });
+
+	bmstu::thread_pool pool(4);
+	for (size_t k : {size_t(0), size_t(1), size_t(50), size_t(5000)})
+	{
+		std::vector<Student> top = v;
+		partial_sort_students(pool, top, k, by_age);
+		ASSERT_EQ(top.size(), v.size());
+		ASSERT_TRUE(std::equal(top.begin(), top.begin() + k, expected.begin()));
+	}
+	std::vector<Student> all = v;
+	partial_sort_students(all, v.size() + 10, by_age);
+	ASSERT_EQ(all, expected);
+}
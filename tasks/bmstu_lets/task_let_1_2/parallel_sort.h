@@ -0,0 +1,233 @@
+#pragma once
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <future>
+#include <thread>
+#include <vector>
+#include "thread_pool.h"
+
+namespace let_detail
+{
+/// Меньше стольких элементов на задачу сортировку не делим
+inline constexpr size_t sort_grain = 1 << 13;
+
+/// Задачи, ожидаемые вместе. wait дожидается всех, даже если какая-то
+/// бросила исключение, и только потом пробрасывает первое. Ожидающий
+/// поток выполняет задачи пула, поэтому группу можно ждать и из задачи
+/// того же пула
+class task_group
+{
+   public:
+	explicit task_group(bmstu::thread_pool& pool) : pool_(pool) {}
+	~task_group()
+	{
+		for (std::future<void>& task : tasks_)
+		{
+			if (task.valid())
+			{
+				help_until_ready_(task);
+			}
+		}
+	}
+
+	template <typename F>
+	void run(F&& task)
+	{
+		tasks_.push_back(pool_.submit(std::forward<F>(task)));
+	}
+
+	void wait()
+	{
+		std::exception_ptr error;
+		for (std::future<void>& task : tasks_)
+		{
+			try
+			{
+				help_until_ready_(task);
+				task.get();
+			}
+			catch (...)
+			{
+				if (!error)
+				{
+					error = std::current_exception();
+				}
+			}
+		}
+		tasks_.clear();
+		if (error)
+		{
+			std::rethrow_exception(error);
+		}
+	}
+
+   private:
+	void help_until_ready_(std::future<void>& task)
+	{
+		while (task.wait_for(std::chrono::seconds(0)) !=
+			   std::future_status::ready)
+		{
+			if (!pool_.run_pending())
+			{
+				std::this_thread::yield();
+			}
+		}
+	}
+
+	bmstu::thread_pool& pool_;
+	std::vector<std::future<void>> tasks_;
+};
+
+/// Число задач для n элементов: по несколько на поток, чтобы неровные
+/// куски не простаивали, но не мельче sort_grain
+inline size_t sort_tasks(const bmstu::thread_pool& pool, size_t n)
+{
+	return std::max<size_t>(1, std::min(pool.size() * 4, n / sort_grain));
+}
+
+/// Сколько элементов a попадает в первые k элементов устойчивого слияния a
+/// и b (поиск co-rank по диагонали merge path)
+template <typename T, typename Less>
+size_t merge_split(const T* a, size_t na, const T* b, size_t nb, size_t k,
+				   const Less& less)
+{
+	size_t lo = k > nb ? k - nb : 0;
+	size_t hi = std::min(k, na);
+	while (lo < hi)
+	{
+		size_t mid = lo + (hi - lo) / 2;
+		if (!less(b[k - mid - 1], a[mid]))
+		{
+			lo = mid + 1;
+		}
+		else
+		{
+			hi = mid;
+		}
+	}
+	return lo;
+}
+
+/// Устойчивая сортировка слиянием в пуле: куски сортируются std::stable_sort,
+/// затем сливаются попарно раундами. Каждое слияние режется по позициям
+/// выхода на независимые части, поэтому и последний раунд занимает все
+/// потоки. T должен быть дешево копируемым (индексы, ключи)
+template <typename T, typename Less>
+void parallel_stable_sort(bmstu::thread_pool& pool, std::vector<T>& v,
+						  const Less& less)
+{
+	size_t n = v.size();
+	size_t tasks = sort_tasks(pool, n);
+	if (tasks == 1)
+	{
+		std::stable_sort(v.begin(), v.end(), less);
+		return;
+	}
+	size_t width = (n + tasks - 1) / tasks;
+	task_group group(pool);
+	for (size_t first = 0; first < n; first += width)
+	{
+		T* lo = v.data() + first;
+		T* hi = v.data() + std::min(n, first + width);
+		group.run([lo, hi, &less] { std::stable_sort(lo, hi, less); });
+	}
+	group.wait();
+
+	std::vector<T> buffer(n);
+	T* src = v.data();
+	T* dst = buffer.data();
+	for (; width < n; width *= 2)
+	{
+		for (size_t first = 0; first < n; first += 2 * width)
+		{
+			size_t middle = std::min(n, first + width);
+			size_t last = std::min(n, first + 2 * width);
+			const T* a = src + first;
+			const T* b = src + middle;
+			size_t na = middle - first;
+			size_t nb = last - middle;
+			size_t total = na + nb;
+			size_t parts = std::max<size_t>(1, tasks * total / n);
+			for (size_t part = 0; part < parts; ++part)
+			{
+				size_t k0 = total * part / parts;
+				size_t k1 = total * (part + 1) / parts;
+				T* out = dst + first + k0;
+				group.run(
+					[=, &less]
+					{
+						size_t i0 = merge_split(a, na, b, nb, k0, less);
+						size_t i1 = merge_split(a, na, b, nb, k1, less);
+						std::merge(a + i0, a + i1, b + (k0 - i0), b + (k1 - i1),
+								   out, less);
+					});
+			}
+		}
+		group.wait();
+		std::swap(src, dst);
+	}
+	if (src != v.data())
+	{
+		v.swap(buffer);
+	}
+}
+
+/// Перестановка order (значения 0..n-1), в начале которой k наименьших по
+/// less в отсортированном порядке; порядок остальных не задан. less должен
+/// быть строгим полным порядком - при равных ключах сравнивать индексы
+template <typename Less>
+void parallel_top_k(bmstu::thread_pool& pool, std::vector<uint32_t>& order,
+					size_t k, const Less& less)
+{
+	size_t n = order.size();
+	k = std::min(k, n);
+	size_t tasks = sort_tasks(pool, n);
+	if (tasks == 1 || k * tasks >= n)
+	{
+		std::partial_sort(order.begin(), order.begin() + k, order.end(), less);
+		return;
+	}
+	// Каждый кусок отбирает свои k лучших, победители ищутся среди них
+	size_t width = (n + tasks - 1) / tasks;
+	task_group group(pool);
+	for (size_t first = 0; first < n; first += width)
+	{
+		uint32_t* lo = order.data() + first;
+		uint32_t* hi = order.data() + std::min(n, first + width);
+		uint32_t* mid = lo + std::min<size_t>(k, hi - lo);
+		group.run([lo, mid, hi, &less]
+				  { std::partial_sort(lo, mid, hi, less); });
+	}
+	group.wait();
+
+	std::vector<uint32_t> candidates;
+	candidates.reserve(k * tasks);
+	for (size_t first = 0; first < n; first += width)
+	{
+		size_t count = std::min(k, std::min(n, first + width) - first);
+		candidates.insert(candidates.end(), order.begin() + first,
+						  order.begin() + first + count);
+	}
+	std::partial_sort(candidates.begin(), candidates.begin() + k,
+					  candidates.end(), less);
+
+	std::vector<bool> selected(n);
+	for (size_t i = 0; i < k; ++i)
+	{
+		selected[candidates[i]] = true;
+	}
+	candidates.resize(k);
+	candidates.reserve(n);
+	for (uint32_t index : order)
+	{
+		if (!selected[index])
+		{
+			candidates.push_back(index);
+		}
+	}
+	order.swap(candidates);
+}
+}  // namespace let_detail
@@ -1,6 +1,12 @@
 #pragma once
+#include <concepts>
 #include <cstdint>
+#include <functional>
+#include <memory>
 #include <string>
+#include <type_traits>
+#include <unordered_set>
+#include <utility>
 #include <vector>
 #include <sstream>
 
@@ -12,11 +18,26 @@ struct ForwardListNode
 	ForwardListNode() = default;
 	ForwardListNode(const T& data_) : data(data_) {}
 	ForwardListNode(T&& data_) : data(std::move(data_)) {}
+	/// Глубокая копия хвоста циклом, без рекурсии по длине списка
 	ForwardListNode(const ForwardListNode& other) : data(other.data)
 	{
-		if (other.next)
+		ForwardListNode* tail = this;
+		try
+		{
+			for (const ForwardListNode* src = other.next; src != nullptr;
+				 src = src->next)
+			{
+				tail->next = new ForwardListNode(src->data);
+				tail = tail->next;
+			}
+		}
+		catch (...)
 		{
-			next = new ForwardListNode(*other.next);
+			while (next != nullptr)
+			{
+				delete std::exchange(next, next->next);
+			}
+			throw;
 		}
 	}
 	ForwardListNode(ForwardListNode&& other) noexcept
@@ -38,14 +59,156 @@ struct ForwardListNode
 	}
 };
 
+/// Непрерывные блоки узлов для списков. Узлы одного create_list лежат
+/// подряд в порядке списка в своем блоке: release(first) освобождает один
+/// список, release() - все разом
+template <typename T>
+class ForwardListArena
+{
+	using node = ForwardListNode<T>;
+
+   public:
+	ForwardListArena() = default;
+	ForwardListArena(const ForwardListArena&) = delete;
+	ForwardListArena& operator=(const ForwardListArena&) = delete;
+	ForwardListArena(ForwardListArena&& other) noexcept
+		: blocks_(std::move(other.blocks_))
+	{
+		other.blocks_.clear();
+	}
+	ForwardListArena& operator=(ForwardListArena&& other) noexcept
+	{
+		if (this != &other)
+		{
+			release();
+			blocks_ = std::move(other.blocks_);
+			other.blocks_.clear();
+		}
+		return *this;
+	}
+	~ForwardListArena() { release(); }
+
+	/// Строит count узлов подряд: make(i) дает значение i-го узла. Узлы
+	/// связаны по порядку, последний указывает на nullptr
+	template <typename Make>
+	node* build(size_t count, Make make)
+	{
+		if (count == 0)
+		{
+			return nullptr;
+		}
+		node* nodes = std::allocator<node>().allocate(count);
+		size_t built = 0;
+		try
+		{
+			for (; built < count; ++built)
+			{
+				std::construct_at(nodes + built, make(built));
+				nodes[built].next = nodes + built + 1;
+			}
+			nodes[count - 1].next = nullptr;
+			blocks_.push_back({nodes, count});
+		}
+		catch (...)
+		{
+			std::destroy_n(nodes, built);
+			std::allocator<node>().deallocate(nodes, count);
+			throw;
+		}
+		return nodes;
+	}
+
+	/// Освобождает блок, который начинается с first, - список из build.
+	/// Поиск идет с последних блоков, так что создание и удаление списков
+	/// по очереди не зависит от их числа
+	void release(node* first) noexcept
+	{
+		for (size_t i = blocks_.size(); i-- != 0;)
+		{
+			if (blocks_[i].nodes == first)
+			{
+				free_(blocks_[i]);
+				blocks_[i] = blocks_.back();
+				blocks_.pop_back();
+				return;
+			}
+		}
+	}
+
+	/// Освобождает все блоки. Для тривиально разрушаемых T - по одному
+	/// вызову на блок, без обхода узлов
+	void release() noexcept
+	{
+		for (const block& b : blocks_)
+		{
+			free_(b);
+		}
+		blocks_.clear();
+	}
+
+   private:
+	struct block
+	{
+		node* nodes;
+		size_t count;
+	};
+
+	static void free_(const block& b) noexcept
+	{
+		if constexpr (!std::is_trivially_destructible_v<T>)
+		{
+			std::destroy_n(b.nodes, b.count);
+		}
+		std::allocator<node>().deallocate(b.nodes, b.count);
+	}
+
+	std::vector<block> blocks_;
+};
+
+template <typename T>
+void delete_list(ForwardListNode<T>*& head)
+{
+	while (head != nullptr)
+	{
+		delete std::exchange(head, head->next);
+	}
+}
+
 template <typename T>
 void create_list(ForwardListNode<T>*& head, const std::vector<T>& data)
 {
+	head = nullptr;
+	ForwardListNode<T>** tail = &head;
+	try
+	{
+		for (const T& value : data)
+		{
+			*tail = new ForwardListNode<T>(value);
+			tail = &(*tail)->next;
+		}
+	}
+	catch (...)
+	{
+		delete_list(head);
+		throw;
+	}
 }
 
+/// Список из data одним блоком арены
 template <typename T>
-void delete_list(ForwardListNode<T>*& head)
+void create_list(ForwardListNode<T>*& head, const std::vector<T>& data,
+				 ForwardListArena<T>& arena)
+{
+	head = arena.build(data.size(),
+					   [&](size_t i) -> const T& { return data[i]; });
+}
+
+/// Удаляет список, построенный в арене: узлы не обходятся, блок списка
+/// освобождается целиком, другие списки арены остаются
+template <typename T>
+void delete_list(ForwardListNode<T>*& head, ForwardListArena<T>& arena)
 {
+	arena.release(std::exchange(head, nullptr));
 }
 
 template <typename T>
@@ -58,7 +221,85 @@ void reverse_list(ForwardListNode<T>*& head)
 {
 }
 
+/// Копия списка одним блоком арены, узлы копии лежат подряд
+template <typename T>
+ForwardListNode<T>* copy_list(const ForwardListNode<T>* head,
+							  ForwardListArena<T>& arena)
+{
+	size_t count = 0;
+	for (const ForwardListNode<T>* node = head; node != nullptr;
+		 node = node->next)
+	{
+		++count;
+	}
+	return arena.build(count,
+					   [&head](size_t) -> const T&
+					   { return std::exchange(head, head->next)->data; });
+}
+
+/// Удаляет повторы, оставляя первое вхождение, за O(n): встреченные
+/// значения запоминаются в хеш-таблице указателями на данные узлов.
+/// Список должен быть из create_list без арены - лишние узлы удаляются
+template <typename T, typename Hash, typename KeyEqual = std::equal_to<T>>
+void remove_duplicates(ForwardListNode<T>*& head, Hash hash,
+					   KeyEqual equal = KeyEqual())
+{
+	auto hash_ptr = [&hash](const T* value) { return hash(*value); };
+	auto equal_ptr = [&equal](const T* a, const T* b)
+	{ return equal(*a, *b); };
+	std::unordered_set<const T*, decltype(hash_ptr), decltype(equal_ptr)> seen(
+		0, hash_ptr, equal_ptr);
+	size_t count = 0;
+	for (const ForwardListNode<T>* node = head; node != nullptr;
+		 node = node->next)
+	{
+		++count;
+	}
+	seen.reserve(count);
+	ForwardListNode<T>** link = &head;
+	while (*link != nullptr)
+	{
+		if (seen.insert(&(*link)->data).second)
+		{
+			link = &(*link)->next;
+		}
+		else
+		{
+			delete std::exchange(*link, (*link)->next);
+		}
+	}
+}
+
+template <typename T>
+concept hashable = requires(const T& value) {
+	{ std::hash<T>{}(value) } -> std::convertible_to<size_t>;
+};
+
+/// С std::hash - за O(n), для типов без него - попарным сравнением за O(n^2)
 template <typename T>
 void remove_duplicates(ForwardListNode<T>*& head)
 {
+	if constexpr (hashable<T>)
+	{
+		remove_duplicates(head, std::hash<T>());
+	}
+	else
+	{
+		for (ForwardListNode<T>* kept = head; kept != nullptr;
+			 kept = kept->next)
+		{
+			ForwardListNode<T>** link = &kept->next;
+			while (*link != nullptr)
+			{
+				if ((*link)->data == kept->data)
+				{
+					delete std::exchange(*link, (*link)->next);
+				}
+				else
+				{
+					link = &(*link)->next;
+				}
+			}
+		}
+	}
 }
@@ -1,5 +1,7 @@
 #include "gtest/gtest.h"
 
+#include <cstdlib>
+#include <numeric>
 #include "base_node_let.h"
 
 TEST(ForwardDummyList, CreateList)
@@ -92,4 +94,119 @@ TEST(ForwardDummyList, RemoveDuplicates)
 	EXPECT_EQ(current, nullptr);
 
 	delete_list(head);
-}
\ No newline at end of file
+}
+
+TEST(ForwardDummyList, ArenaList)
+{
+	std::vector<std::string> data;
+	for (int i = 0; i < 1000; ++i)
+	{
+		data.push_back("node " + std::to_string(i));
+	}
+	ForwardListArena<std::string> arena;
+	ForwardListNode<std::string>* head = nullptr;
+	create_list(head, data, arena);
+
+	ForwardListNode<std::string>* current = head;
+	for (size_t i = 0; i < data.size(); ++i)
+	{
+		ASSERT_NE(current, nullptr);
+		EXPECT_EQ(current->data, data[i]);
+		// Узлы лежат подряд в порядке списка
+		EXPECT_EQ(current, head + i);
+		current = current->next;
+	}
+	EXPECT_EQ(current, nullptr);
+
+	ForwardListNode<std::string>* empty = head;
+	create_list(empty, std::vector<std::string>{}, arena);
+	EXPECT_EQ(empty, nullptr);
+
+	ForwardListNode<std::string>* other = nullptr;
+	create_list(other, std::vector<std::string>{"a", "b"}, arena);
+	delete_list(head, arena);
+	EXPECT_EQ(head, nullptr);
+	// Остальные списки арены не затронуты
+	ASSERT_NE(other, nullptr);
+	EXPECT_EQ(other->data, "a");
+	EXPECT_EQ(other->next->data, "b");
+	delete_list(other, arena);
+}
+
+namespace
+{
+template <typename T>
+std::vector<T> list_values(const ForwardListNode<T>* head)
+{
+	std::vector<T> values;
+	for (; head != nullptr; head = head->next)
+	{
+		values.push_back(head->data);
+	}
+	return values;
+}
+
+/// Тип без std::hash - для него остается попарное сравнение
+struct Point
+{
+	int x;
+	int y;
+	bool operator==(const Point&) const = default;
+};
+}  // namespace
+
+TEST(ForwardDummyList, CopyLongList)
+{
+	std::vector<int> data(1 << 20);
+	std::iota(data.begin(), data.end(), 0);
+	ForwardListNode<int>* head = nullptr;
+	create_list(head, data);
+
+	// Рекурсивная копия такой длины переполнила бы стек
+	auto* copy = new ForwardListNode<int>(*head);
+	EXPECT_EQ(list_values(copy), data);
+
+	ForwardListArena<int> arena;
+	ForwardListNode<int>* packed = copy_list(head, arena);
+	EXPECT_EQ(list_values(packed), data);
+	EXPECT_EQ(packed[data.size() - 1].next, nullptr);
+	EXPECT_EQ(copy_list<int>(nullptr, arena), nullptr);
+
+	delete_list(copy);
+	delete_list(head);
+	delete_list(packed, arena);
+}
+
+TEST(ForwardDummyList, RemoveDuplicatesHashed)
+{
+	std::vector<std::string> data;
+	std::vector<std::string> expected;
+	for (int i = 0; i < 100000; ++i)
+	{
+		data.push_back(std::to_string(i % 1000 * 7919 % 1000));
+		if (i < 1000)
+		{
+			expected.push_back(data.back());
+		}
+	}
+	ForwardListNode<std::string>* head = nullptr;
+	create_list(head, data);
+	remove_duplicates(head);
+	EXPECT_EQ(list_values(head), expected);
+	delete_list(head);
+
+	std::vector<int> numbers = {5, -5, 3, 5, -3, 4};
+	ForwardListNode<int>* abs_head = nullptr;
+	create_list(abs_head, numbers);
+	remove_duplicates(
+		abs_head, [](int x) { return std::hash<int>()(std::abs(x)); },
+		[](int a, int b) { return std::abs(a) == std::abs(b); });
+	EXPECT_EQ(list_values(abs_head), (std::vector<int>{5, 3, 4}));
+	delete_list(abs_head);
+
+	ForwardListNode<Point>* points = nullptr;
+	create_list(points, std::vector<Point>{{1, 2}, {1, 2}, {2, 1}, {1, 2}});
+	remove_duplicates(points);
+	EXPECT_EQ(list_values(points), (std::vector<Point>{{1, 2}, {2, 1}}));
+	delete_list(points);
+}
@@ -1,7 +1,16 @@
+#pragma once
+#include <algorithm>
+#include <compare>
 #include <cstddef>
+#include <initializer_list>
 #include <iterator>
 #include <ostream>
+#include <type_traits>
+#include <utility>
 #include "abstract_iterator.h"
+#include "bmstu_format.h"
+#include "bmstu_hash.h"
+#include "bmstu_stats.h"
 
 namespace bmstu
 {
@@ -13,7 +22,12 @@ class list
 		node() = default;
 
 		node(node* prev, const T& value, node* next)
-			: next_node_(nullptr), prev_node_(nullptr)
+			: value_(value), next_node_(next), prev_node_(prev)
+		{
+		}
+
+		node(node* prev, T&& value, node* next)
+			: value_(std::move(value)), next_node_(next), prev_node_(prev)
 		{
 		}
 
@@ -26,37 +40,65 @@ class list
 	struct iterator
 		: public abstract_iterator<iterator, T, std::bidirectional_iterator_tag>
 	{
+		using base =
+			abstract_iterator<iterator, T, std::bidirectional_iterator_tag>;
+		using typename base::difference_type;
+		using typename base::pointer;
+		using typename base::reference;
+
 		node* current;
 		iterator() : current(nullptr) {}
 		iterator(node* node) : current(node) {}
-		iterator& operator++() override { return *this; }
-		iterator& operator--() override { return *this; }
-		iterator operator++(int) override { return nullptr; }
-		iterator operator--(int) override { return nullptr; }
-		iterator& operator+=(const iterator::difference_type& n) override
+		iterator& operator++() override
 		{
+			current = current->next_node_;
 			return *this;
 		}
-		iterator& operator-=(const iterator::difference_type& n) override
+		iterator& operator--() override
 		{
+			current = current->prev_node_;
 			return *this;
 		}
-		iterator operator+(const iterator::difference_type& n) const override
+		iterator operator++(int) override
+		{
+			iterator copy(*this);
+			++(*this);
+			return copy;
+		}
+		iterator operator--(int) override
 		{
-			return nullptr;
+			iterator copy(*this);
+			--(*this);
+			return copy;
 		}
-		iterator operator-(const iterator::difference_type& n) const override
+		iterator& operator+=(const difference_type& n) override
 		{
-			return nullptr;
+			for (difference_type i = 0; i < n; ++i)
+			{
+				++(*this);
+			}
+			for (difference_type i = 0; i > n; --i)
+			{
+				--(*this);
+			}
+			return *this;
 		}
-		iterator::reference operator*() const override
+		iterator& operator-=(const difference_type& n) override
 		{
-			return current->value_;
+			return *this += -n;
 		}
-		iterator::pointer operator->() const override
+		iterator operator+(const difference_type& n) const override
 		{
-			return &(current->value_);
+			iterator copy(*this);
+			return copy += n;
 		}
+		iterator operator-(const difference_type& n) const override
+		{
+			iterator copy(*this);
+			return copy -= n;
+		}
+		reference operator*() const override { return current->value_; }
+		pointer operator->() const override { return &(current->value_); }
 		bool operator==(const iterator& other) const override
 		{
 			return current == other.current;
@@ -66,26 +108,63 @@ class list
 			return current != other.current;
 		}
 		explicit operator bool() const override { return current != nullptr; }
-		iterator::difference_type operator-(
-			const iterator& other) const override
+		difference_type operator-(const iterator& other) const override
 		{
-			return 0;
+			difference_type distance = 0;
+			for (node* it = other.current; it != current; it = it->next_node_)
+			{
+				++distance;
+			}
+			return distance;
 		}
 	};
 	using const_iterator = iterator;
 
-	list() {}
+	list() : tail_(new_node_()), head_(new_node_())
+	{
+		head_->next_node_ = tail_;
+		tail_->prev_node_ = head_;
+	}
 
 	template <typename it>
-	list(it begin, it end)
+	list(it begin, it end) : list()
 	{
+		for (; begin != end; ++begin)
+		{
+			push_back(*begin);
+		}
 	}
 
-	list(std::initializer_list<T> values) {}
+	list(std::initializer_list<T> values) : list(values.begin(), values.end())
+	{
+	}
 
-	list(const list& other) {}
+	list(const list& other) : list(other.begin(), other.end())
+	{
+		stats_hook::copy(stats_kind_);
+	}
 
-	list(list&& other) {}
+	list(list&& other) : list() { swap(other); }
+
+	list& operator=(const list& other)
+	{
+		if (this != &other)
+		{
+			list copy(other);
+			swap(copy);
+		}
+		return *this;
+	}
+
+	list& operator=(list&& other) noexcept
+	{
+		if (this != &other)
+		{
+			clear();
+			swap(other);
+		}
+		return *this;
+	}
 
 #pragma endregion
 #pragma region pushs
@@ -94,7 +173,16 @@ class list
 	void push_back(const Type& value)
 	{
 		node* last = tail_->prev_node_;
-		node* new_last = new node(tail_->prev_node_, value, tail_);
+		node* new_last = new_node_(tail_->prev_node_, value, tail_);
+		tail_->prev_node_ = new_last;
+		last->next_node_ = new_last;
+		++size_;
+	}
+
+	void push_back(T&& value)
+	{
+		node* last = tail_->prev_node_;
+		node* new_last = new_node_(last, std::move(value), tail_);
 		tail_->prev_node_ = new_last;
 		last->next_node_ = new_last;
 		++size_;
@@ -105,7 +193,7 @@ class list
 	{
 		// адрес реального последнего элемента
 		node* first = head_->next_node_;
-		node* new_first = new node(head_, value, first);
+		node* new_first = new_node_(head_, value, first);
 		head_->next_node_ = new_first;
 		first->prev_node_ = new_first;
 		++size_;
@@ -113,6 +201,20 @@ class list
 
 #pragma endregion
 
+	T& front() noexcept { return head_->next_node_->value_; }
+
+	const T& front() const noexcept { return head_->next_node_->value_; }
+
+	/// Удаляет первый элемент; список не пуст
+	void pop_front() noexcept
+	{
+		node* first = head_->next_node_;
+		head_->next_node_ = first->next_node_;
+		first->next_node_->prev_node_ = head_;
+		delete first;
+		--size_;
+	}
+
 	bool empty() const
 
 		noexcept
@@ -120,16 +222,36 @@ class list
 		return (size_ == 0u);
 	}
 
-	~list() {}
+	~list()
+	{
+		clear();
+		delete head_;
+		delete tail_;
+	}
 
-	void clear() {}
+	void clear()
+	{
+		node* current = head_->next_node_;
+		while (current != tail_)
+		{
+			node* next = current->next_node_;
+			delete current;
+			current = next;
+		}
+		head_->next_node_ = tail_;
+		tail_->prev_node_ = head_;
+		size_ = 0;
+	}
 
-	size_t size() const { return 0; }
+	size_t size() const { return size_; }
 
 	void swap(list& other)
 
 		noexcept
 	{
+		std::swap(head_, other.head_);
+		std::swap(tail_, other.tail_);
+		std::swap(size_, other.size_);
 	}
 
 	friend void swap(list& l, list& r) { l.swap(r); }
@@ -180,34 +302,106 @@ class list
 
 #pragma endregion
 
-	T operator[](size_t pos) const {}
+	T operator[](size_t pos) const
+	{
+		return *(begin() + static_cast<std::ptrdiff_t>(pos));
+	}
 
-	T& operator[](size_t pos) {}
+	T& operator[](size_t pos)
+	{
+		return *(begin() + static_cast<std::ptrdiff_t>(pos));
+	}
 
-	friend bool operator==(const list& l, const list& r) { return true; }
+	friend bool operator==(const list& l, const list& r)
+	{
+		return l.size_ == r.size_ && std::equal(l.begin(), l.end(), r.begin());
+	}
 
-	friend bool operator!=(const list& l, const list& r) { return false; }
+	friend bool operator!=(const list& l, const list& r) { return !(l == r); }
 
-	friend auto operator<=>(const list& lhs, const list& rhs) { return true; }
+	friend auto operator<=>(const list& lhs, const list& rhs)
+	{
+		if (lexicographical_compare_(lhs, rhs))
+		{
+			return std::weak_ordering::less;
+		}
+		if (lexicographical_compare_(rhs, lhs))
+		{
+			return std::weak_ordering::greater;
+		}
+		return std::weak_ordering::equivalent;
+	}
 
+	/// {e0, e1, ...}. Числа печатаются одним os.write
 	friend std::ostream& operator<<(std::ostream& os, const list& other)
 	{
-		return os;
+		return detail::print_range(os, other.begin(), other.end(), "{", ", ",
+								   "}");
 	}
 
 	iterator insert(const_iterator pos, const T& value)
 	{
-		return iterator{nullptr};
+		node* next = pos.current;
+		node* prev = next->prev_node_;
+		node* inserted = new_node_(prev, value, next);
+		prev->next_node_ = inserted;
+		next->prev_node_ = inserted;
+		++size_;
+		return iterator{inserted};
 	}
 
    private:
+	static constexpr container_kind stats_kind_ = container_kind::list;
+
+	/// Узел с учетом в bmstu::stats: значение-rvalue T считается переносом,
+	/// остальное - копией; у служебных узлов значения нет
+	template <typename... Args>
+	static node* new_node_(Args&&... args)
+	{
+		stats_hook::allocation(stats_kind_, sizeof(node));
+		if constexpr ((std::is_same_v<Args, T> || ...))
+		{
+			stats_hook::element_moves(stats_kind_, 1);
+		}
+		else if constexpr (sizeof...(Args) != 0)
+		{
+			stats_hook::element_copies(stats_kind_, 1);
+		}
+		return new node(std::forward<Args>(args)...);
+	}
+
 	static bool lexicographical_compare_(const list<T>& l, const list<T>& r)
 	{
-		return "123";
+		return std::lexicographical_compare(l.begin(), l.end(), r.begin(),
+											r.end());
 	}
 
 	size_t size_ = 0;
 	node* tail_ = nullptr;
 	node* head_ = nullptr;
 };
-}  // namespace bmstu
\ No newline at end of file
+}  // namespace bmstu
+
+template <typename T>
+struct std::hash<bmstu::list<T>>
+{
+	size_t operator()(const bmstu::list<T>& list) const noexcept
+	{
+		return bmstu::hash_range<T>(list.begin(), list.end(), list.size());
+	}
+};
+
+#if defined(__cpp_lib_format)
+template <typename T, typename CharT>
+struct std::formatter<bmstu::list<T>, CharT>
+	: bmstu::detail::range_formatter<T, CharT>
+{
+	template <typename FormatContext>
+	typename FormatContext::iterator format(const bmstu::list<T>& list,
+											FormatContext& ctx) const
+	{
+		return this->format_range(list.begin(), list.end(), "{", ", ", "}",
+								  ctx);
+	}
+};
+#endif
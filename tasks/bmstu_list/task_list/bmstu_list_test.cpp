@@ -1,7 +1,10 @@
 #include "bmstu_list.h"
+#include "alloc_tracker.h"
 
 #include <gtest/gtest.h>
 #include <algorithm>
+#include <string>
+#include <unordered_set>
 
 TEST(BidirectLinkedListTests, init)
 {
@@ -535,4 +538,62 @@ TEST(BidirectLinkedListTests, from_vector)
 										"string4"s, "string5"s, "string6"s,
 										"string7"s, "end_string"s}),
 			  my_vec);
-}
\ No newline at end of file
+}
+TEST(BidirectLinkedListTests, hash)
+{
+	std::unordered_set<bmstu::list<int>> set;
+	set.insert(bmstu::list<int>{1, 2, 3});
+	set.insert(bmstu::list<int>{1, 2, 3});
+	set.insert(bmstu::list<int>{1, 2});
+	set.insert(bmstu::list<int>{});
+	ASSERT_EQ(set.size(), 3);
+}
+
+TEST(ListTest, AllocationBudget)
+{
+	bmstu::list<int> l;
+	EXPECT_ALLOCS(1, l.push_back(1));
+	EXPECT_ALLOCS(1, l.push_front(0));
+	EXPECT_ALLOCS(1, l.insert(l.begin(), -1));
+	EXPECT_ALLOCS(0, for (int value : l) { (void)value; });
+	// Два служебных узла и по узлу на элемент
+	EXPECT_ALLOCS(5, bmstu::list<int> copy(l));
+}
+
+TEST(ListTest, FrontPopAndMovePush)
+{
+	bmstu::list<std::string> l;
+	std::string value(100, 'x');
+	l.push_back(std::move(value));
+	l.push_back("second");
+	ASSERT_EQ(l.front().size(), 100u);
+	l.pop_front();
+	ASSERT_EQ(l.size(), 1u);
+	ASSERT_EQ(l.front(), "second");
+	l.pop_front();
+	ASSERT_TRUE(l.empty());
+	ASSERT_EQ(l.begin(), l.end());
+	l.push_back("again");
+	ASSERT_EQ(l.front(), "again");
+}
+
+TEST(ListTest, PrintNumbers)
+{
+	bmstu::list<double> l = {2.5, -0.125, 1e-7};
+	std::stringstream out;
+	out << l;
+	ASSERT_EQ(out.str(), "{2.5, -0.125, 1e-07}");
+	bmstu::list<bool> flags = {true, false};
+	std::stringstream flags_out;
+	flags_out << std::boolalpha << flags;
+	ASSERT_EQ(flags_out.str(), "{true, false}");
+}
+
+#if defined(__cpp_lib_format)
+TEST(ListTest, Format)
+{
+	bmstu::list<int> l = {1, -2, 3};
+	ASSERT_EQ(std::format("{}", l), "{1, -2, 3}");
+	ASSERT_EQ(std::format("{:+}", l), "{+1, -2, +3}");
+}
+#endif
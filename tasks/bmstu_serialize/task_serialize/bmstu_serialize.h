@@ -0,0 +1,508 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include "bmstu_list.h"
+#include "bmstu_simple_vector.h"
+#include "bmstu_string.h"
+
+/// Двоичный формат контейнеров bmstu, все числа little-endian:
+///   заголовок 16 байт - "bmst", версия u16, вид контейнера u8, 0 u8,
+///   размер элемента u32 (0 - элементы сами контейнеры), 0 u32;
+///   тело - число элементов u64 и элементы подряд.
+/// Вложенные контейнеры пишутся одним телом, без заголовка. Элементы
+/// тривиально копируемых типов пишутся байтами как есть, поэтому
+/// читающая сторона должна иметь ту же раскладку структур
+
+namespace bmstu::serial
+{
+inline constexpr uint16_t format_version = 1;
+inline constexpr size_t header_size = 16;
+
+class format_error : public std::runtime_error
+{
+   public:
+	using std::runtime_error::runtime_error;
+};
+
+namespace detail
+{
+inline constexpr char magic[4] = {'b', 'm', 's', 't'};
+
+/// Размер куска чтения, когда длину потока узнать нельзя: длине из
+/// данных не доверяем больше, чем на столько байт вперед
+inline constexpr size_t untrusted_chunk = 1 << 20;
+
+enum class kind : uint8_t
+{
+	simple_vector = 1,
+	list = 2,
+	string = 3
+};
+
+template <typename C>
+struct container_traits
+{
+	static constexpr bool is_container = false;
+};
+
+template <typename T>
+struct container_traits<simple_vector<T>>
+{
+	static constexpr bool is_container = true;
+	static constexpr kind tag = kind::simple_vector;
+	using value_type = T;
+};
+
+template <typename T>
+struct container_traits<list<T>>
+{
+	static constexpr bool is_container = true;
+	static constexpr kind tag = kind::list;
+	using value_type = T;
+};
+
+template <typename T, typename Alloc>
+struct container_traits<basic_string<T, Alloc>>
+{
+	static constexpr bool is_container = true;
+	static constexpr kind tag = kind::string;
+	using value_type = T;
+};
+
+template <typename T>
+concept container = container_traits<T>::is_container;
+
+template <typename T>
+concept raw_element = std::is_trivially_copyable_v<T> && !container<T>;
+
+template <typename T>
+concept element = raw_element<T> || container<T>;
+
+/// Байты элемента совпадают с форматом без перестановки
+template <typename T>
+constexpr bool bytes_as_is = std::endian::native == std::endian::little ||
+							 !std::is_arithmetic_v<T> || sizeof(T) == 1;
+
+template <raw_element T>
+T to_little(T value) noexcept
+{
+	if constexpr (bytes_as_is<T>)
+	{
+		return value;
+	}
+	else
+	{
+		auto bytes = std::bit_cast<std::array<std::byte, sizeof(T)>>(value);
+		std::reverse(bytes.begin(), bytes.end());
+		return std::bit_cast<T>(bytes);
+	}
+}
+
+inline void write_bytes(std::ostream& os, const void* data, size_t size)
+{
+	os.write(static_cast<const char*>(data),
+			 static_cast<std::streamsize>(size));
+	if (!os)
+	{
+		throw format_error("bmstu::serial: write failed");
+	}
+}
+
+inline void read_bytes(std::istream& is, void* data, size_t size)
+{
+	is.read(static_cast<char*>(data), static_cast<std::streamsize>(size));
+	if (static_cast<size_t>(is.gcount()) != size)
+	{
+		throw format_error("bmstu::serial: unexpected end of data");
+	}
+}
+
+/// Сколько байт осталось в потоке или SIZE_MAX, если поток не позволяет
+/// seek (канал, сокет)
+inline size_t stream_remaining(std::istream& is)
+{
+	std::streambuf* buf = is.rdbuf();
+	std::streampos here =
+		buf->pubseekoff(0, std::ios_base::cur, std::ios_base::in);
+	if (here == std::streampos(-1))
+	{
+		return std::numeric_limits<size_t>::max();
+	}
+	std::streampos end =
+		buf->pubseekoff(0, std::ios_base::end, std::ios_base::in);
+	buf->pubseekpos(here, std::ios_base::in);
+	if (end == std::streampos(-1))
+	{
+		return std::numeric_limits<size_t>::max();
+	}
+	return static_cast<size_t>(end - here);
+}
+
+/// Число элементов тела. Если длина потока известна, сразу отвергает
+/// число, для которого данных не хватит даже по min_bytes на элемент
+class body_reader
+{
+   public:
+	body_reader(std::istream& is, size_t min_bytes)
+		: is_(is), remaining_(stream_remaining(is))
+	{
+		uint64_t count = 0;
+		read_bytes(is_, &count, sizeof(count));
+		count = to_little(count);
+		remaining_ -= remaining_ != std::numeric_limits<size_t>::max()
+						  ? sizeof(count)
+						  : 0;
+		if (count > std::numeric_limits<size_t>::max() ||
+			(min_bytes != 0 && count > remaining_ / min_bytes))
+		{
+			throw format_error("bmstu::serial: element count exceeds data");
+		}
+		count_ = static_cast<size_t>(count);
+	}
+
+	size_t count() const noexcept { return count_; }
+
+	/// Сколько элементов размера size читать за один read: все сразу, если
+	/// их наличие уже проверено
+	size_t chunk(size_t left, size_t size) const noexcept
+	{
+		if (remaining_ != std::numeric_limits<size_t>::max())
+		{
+			return left;
+		}
+		return std::min(left, std::max<size_t>(1, untrusted_chunk / size));
+	}
+
+	std::istream& stream() const noexcept { return is_; }
+
+   private:
+	std::istream& is_;
+	size_t remaining_;
+	size_t count_ = 0;
+};
+
+template <raw_element T>
+void write_raw(std::ostream& os, const T* data, size_t count)
+{
+	if constexpr (bytes_as_is<T>)
+	{
+		write_bytes(os, data, count * sizeof(T));
+	}
+	else
+	{
+		std::array<T, 256> buffer;
+		for (size_t done = 0; done < count;)
+		{
+			size_t n = std::min(buffer.size(), count - done);
+			std::transform(data + done, data + done + n, buffer.begin(),
+						   to_little<T>);
+			write_bytes(os, buffer.data(), n * sizeof(T));
+			done += n;
+		}
+	}
+}
+
+template <raw_element T>
+void read_raw(std::istream& is, T* data, size_t count)
+{
+	read_bytes(is, data, count * sizeof(T));
+	if constexpr (!bytes_as_is<T>)
+	{
+		std::transform(data, data + count, data, to_little<T>);
+	}
+}
+
+inline void write_count(std::ostream& os, size_t count)
+{
+	uint64_t value = to_little(static_cast<uint64_t>(count));
+	write_bytes(os, &value, sizeof(value));
+}
+
+/// Минимальный размер элемента в теле: вложенное тело - хотя бы счетчик
+template <element T>
+constexpr size_t min_element_bytes()
+{
+	if constexpr (raw_element<T>)
+	{
+		return sizeof(T);
+	}
+	else
+	{
+		return sizeof(uint64_t);
+	}
+}
+
+template <element T>
+void write_body(std::ostream& os, const simple_vector<T>& v);
+template <element T>
+void write_body(std::ostream& os, const list<T>& l);
+template <raw_element T, typename Alloc>
+void write_body(std::ostream& os, const basic_string<T, Alloc>& str);
+template <element T>
+void read_body(std::istream& is, simple_vector<T>& v);
+template <element T>
+void read_body(std::istream& is, list<T>& l);
+template <raw_element T, typename Alloc>
+void read_body(std::istream& is, basic_string<T, Alloc>& str);
+
+template <element T>
+void write_body(std::ostream& os, const simple_vector<T>& v)
+{
+	write_count(os, v.size());
+	if constexpr (raw_element<T>)
+	{
+		if (v.size() != 0)
+		{
+			write_raw<T>(os, &v[0], v.size());
+		}
+	}
+	else
+	{
+		for (const T& item : v)
+		{
+			write_body(os, item);
+		}
+	}
+}
+
+/// Узлы списка не лежат подряд, поэтому элементы копируются в буфер и
+/// пишутся кусками
+template <element T>
+void write_body(std::ostream& os, const list<T>& l)
+{
+	write_count(os, l.size());
+	if constexpr (raw_element<T>)
+	{
+		constexpr size_t buffer_items = std::max<size_t>(1, 4096 / sizeof(T));
+		alignas(T) std::byte buffer[buffer_items * sizeof(T)];
+		size_t filled = 0;
+		for (const T& item : l)
+		{
+			T little = to_little(item);
+			std::memcpy(buffer + filled * sizeof(T), &little, sizeof(T));
+			if (++filled == buffer_items)
+			{
+				write_bytes(os, buffer, filled * sizeof(T));
+				filled = 0;
+			}
+		}
+		write_bytes(os, buffer, filled * sizeof(T));
+	}
+	else
+	{
+		for (const T& item : l)
+		{
+			write_body(os, item);
+		}
+	}
+}
+
+template <raw_element T, typename Alloc>
+void write_body(std::ostream& os, const basic_string<T, Alloc>& str)
+{
+	write_count(os, str.size());
+	write_raw(os, str.c_str(), str.size());
+}
+
+template <element T>
+void read_body(std::istream& is, simple_vector<T>& v)
+{
+	body_reader body(is, min_element_bytes<T>());
+	v.clear();
+	if constexpr (raw_element<T>)
+	{
+		for (size_t done = 0; done < body.count();)
+		{
+			size_t n = body.chunk(body.count() - done, sizeof(T));
+			v.resize(done + n);
+			read_raw(is, &v[done], n);
+			done += n;
+		}
+	}
+	else
+	{
+		v.reserve(body.chunk(body.count(), sizeof(T)));
+		for (size_t i = 0; i < body.count(); ++i)
+		{
+			T item;
+			read_body(is, item);
+			v.push_back(std::move(item));
+		}
+	}
+}
+
+template <element T>
+void read_body(std::istream& is, list<T>& l)
+{
+	body_reader body(is, min_element_bytes<T>());
+	l.clear();
+	for (size_t i = 0; i < body.count(); ++i)
+	{
+		if constexpr (raw_element<T>)
+		{
+			T item;
+			read_raw(is, &item, 1);
+			l.push_back(item);
+		}
+		else
+		{
+			T item;
+			read_body(is, item);
+			l.push_back(std::move(item));
+		}
+	}
+}
+
+template <raw_element T, typename Alloc>
+void read_body(std::istream& is, basic_string<T, Alloc>& str)
+{
+	body_reader body(is, sizeof(T));
+	str.resize_and_overwrite(0, [](T*, size_t) { return 0; });
+	for (size_t done = 0; done < body.count();)
+	{
+		size_t n = body.chunk(body.count() - done, sizeof(T));
+		str.resize_and_overwrite(done + n,
+								 [&](T* data, size_t size)
+								 {
+									 read_raw(is, data + done, n);
+									 return size;
+								 });
+		done += n;
+	}
+}
+
+template <container C>
+uint32_t element_size_field()
+{
+	using T = typename container_traits<C>::value_type;
+	if constexpr (raw_element<T>)
+	{
+		return static_cast<uint32_t>(sizeof(T));
+	}
+	else
+	{
+		return 0;
+	}
+}
+
+template <container C>
+void write_header(std::ostream& os)
+{
+	std::array<std::byte, header_size> header{};
+	uint16_t version = to_little(format_version);
+	uint32_t element_size = to_little(element_size_field<C>());
+	std::memcpy(header.data(), magic, sizeof(magic));
+	std::memcpy(header.data() + 4, &version, sizeof(version));
+	header[6] = static_cast<std::byte>(container_traits<C>::tag);
+	std::memcpy(header.data() + 8, &element_size, sizeof(element_size));
+	write_bytes(os, header.data(), header.size());
+}
+
+template <container C>
+void check_header(const std::byte* header)
+{
+	uint16_t version = 0;
+	uint32_t element_size = 0;
+	std::memcpy(&version, header + 4, sizeof(version));
+	std::memcpy(&element_size, header + 8, sizeof(element_size));
+	if (std::memcmp(header, magic, sizeof(magic)) != 0)
+	{
+		throw format_error("bmstu::serial: not a bmstu container");
+	}
+	if (to_little(version) != format_version)
+	{
+		throw format_error("bmstu::serial: unsupported format version");
+	}
+	if (header[6] != static_cast<std::byte>(container_traits<C>::tag))
+	{
+		throw format_error("bmstu::serial: container kind mismatch");
+	}
+	if (to_little(element_size) != element_size_field<C>())
+	{
+		throw format_error("bmstu::serial: element size mismatch");
+	}
+}
+
+/// Элементы контейнера C внутри buffer без копирования
+template <container C>
+std::span<const typename container_traits<C>::value_type> view_elements(
+	std::span<const std::byte> buffer)
+{
+	using T = typename container_traits<C>::value_type;
+	static_assert(raw_element<T>, "only flat containers can be viewed");
+	if (buffer.size() < header_size + sizeof(uint64_t))
+	{
+		throw format_error("bmstu::serial: unexpected end of data");
+	}
+	check_header<C>(buffer.data());
+	if constexpr (!bytes_as_is<T>)
+	{
+		throw format_error("bmstu::serial: views need a little-endian host");
+	}
+	uint64_t count = 0;
+	std::memcpy(&count, buffer.data() + header_size, sizeof(count));
+	count = to_little(count);
+	const std::byte* first = buffer.data() + header_size + sizeof(count);
+	size_t available = buffer.size() - header_size - sizeof(count);
+	if (count > available / sizeof(T))
+	{
+		throw format_error("bmstu::serial: element count exceeds data");
+	}
+	if (reinterpret_cast<uintptr_t>(first) % alignof(T) != 0)
+	{
+		throw format_error("bmstu::serial: buffer is misaligned for view");
+	}
+	return {reinterpret_cast<const T*>(first), static_cast<size_t>(count)};
+}
+}  // namespace detail
+
+/// Пишет заголовок и тело. Тривиально копируемые элементы simple_vector и
+/// basic_string уходят одним os.write
+template <detail::container C>
+void write(std::ostream& os, const C& container)
+{
+	detail::write_header<C>(os);
+	detail::write_body(os, container);
+}
+
+/// Читает контейнер, записанный write. Плоские simple_vector и
+/// basic_string читаются одним is.read, если поток позволяет узнать
+/// оставшуюся длину. Ошибки данных - format_error
+template <detail::container C>
+C read(std::istream& is)
+{
+	std::array<std::byte, header_size> header;
+	detail::read_bytes(is, header.data(), header.size());
+	detail::check_header<C>(header.data());
+	C container;
+	detail::read_body(is, container);
+	return container;
+}
+
+/// Элементы simple_vector<T> из буфера с результатом write без копирования.
+/// Буфер должен жить дольше результата и быть выровнен под T
+template <detail::raw_element T>
+std::span<const T> view_vector(std::span<const std::byte> buffer)
+{
+	return detail::view_elements<simple_vector<T>>(buffer);
+}
+
+template <detail::raw_element T>
+std::basic_string_view<T> view_string(std::span<const std::byte> buffer)
+{
+	std::span<const T> chars = detail::view_elements<basic_string<T>>(buffer);
+	return {chars.data(), chars.size()};
+}
+}  // namespace bmstu::serial
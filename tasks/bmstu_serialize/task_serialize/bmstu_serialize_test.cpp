@@ -0,0 +1,247 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <sstream>
+#include <string>
+#include "bmstu_serialize.h"
+
+namespace
+{
+struct point
+{
+	int32_t x;
+	int32_t y;
+	double weight;
+
+	friend bool operator==(const point&, const point&) = default;
+};
+
+using string_vector = bmstu::simple_vector<bmstu::string>;
+
+template <typename C>
+std::string to_bytes(const C& container)
+{
+	std::ostringstream os;
+	bmstu::serial::write(os, container);
+	return os.str();
+}
+
+template <typename C>
+C from_bytes(const std::string& bytes)
+{
+	std::istringstream is(bytes);
+	return bmstu::serial::read<C>(is);
+}
+
+/// Поток без seek, как канал: длина данных заранее неизвестна
+class pipe_buf : public std::streambuf
+{
+   public:
+	explicit pipe_buf(const std::string& bytes) : bytes_(bytes)
+	{
+		char* first = bytes_.data();
+		setg(first, first, first + bytes_.size());
+	}
+
+   private:
+	std::string bytes_;
+};
+
+template <typename T>
+bool same(const bmstu::simple_vector<T>& a, const bmstu::simple_vector<T>& b)
+{
+	return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin());
+}
+}  // namespace
+
+TEST(Serialize, VectorRoundTrip)
+{
+	bmstu::simple_vector<int> v = {1, -2, 3, 1 << 30};
+	EXPECT_TRUE(same(from_bytes<bmstu::simple_vector<int>>(to_bytes(v)), v));
+	bmstu::simple_vector<point> points = {{1, 2, 0.5}, {-3, 4, 1e300}};
+	auto points_back =
+		from_bytes<bmstu::simple_vector<point>>(to_bytes(points));
+	EXPECT_TRUE(same(points_back, points));
+	bmstu::simple_vector<double> empty;
+	EXPECT_EQ(from_bytes<bmstu::simple_vector<double>>(to_bytes(empty)).size(),
+			  0u);
+}
+
+TEST(Serialize, StringRoundTrip)
+{
+	bmstu::string str = "binary format";
+	EXPECT_EQ(from_bytes<bmstu::string>(to_bytes(str)), str);
+	bmstu::u16string wide = {u'п', u'р', u'и', u'в', u'е', u'т'};
+	EXPECT_EQ(from_bytes<bmstu::u16string>(to_bytes(wide)), wide);
+	bmstu::string empty;
+	EXPECT_EQ(from_bytes<bmstu::string>(to_bytes(empty)).size(), 0u);
+}
+
+TEST(Serialize, ListRoundTrip)
+{
+	bmstu::list<int64_t> l;
+	for (int64_t i = 0; i < 5000; ++i)
+	{
+		l.push_back(i * i - 7);
+	}
+	EXPECT_EQ(from_bytes<bmstu::list<int64_t>>(to_bytes(l)), l);
+}
+
+TEST(Serialize, NestedRoundTrip)
+{
+	string_vector words = {"one", "", "three"};
+	auto back = from_bytes<string_vector>(to_bytes(words));
+	EXPECT_TRUE(same(back, words));
+
+	bmstu::list<bmstu::simple_vector<int>> rows;
+	rows.push_back(bmstu::simple_vector<int>{1, 2, 3});
+	rows.push_back(bmstu::simple_vector<int>{});
+	rows.push_back(bmstu::simple_vector<int>{4});
+	EXPECT_EQ(from_bytes<bmstu::list<bmstu::simple_vector<int>>>(to_bytes(rows))
+				  .size(),
+			  3u);
+	auto rows_back =
+		from_bytes<bmstu::list<bmstu::simple_vector<int>>>(to_bytes(rows));
+	auto expected = rows.begin();
+	for (const bmstu::simple_vector<int>& row : rows_back)
+	{
+		EXPECT_TRUE(same(row, *expected));
+		++expected;
+	}
+}
+
+TEST(Serialize, Layout)
+{
+	bmstu::simple_vector<uint16_t> v = {0x0102, 0x0304};
+	std::string bytes = to_bytes(v);
+	ASSERT_EQ(bytes.size(), bmstu::serial::header_size + 8 + 4);
+	EXPECT_EQ(bytes.substr(0, 4), "bmst");
+	EXPECT_EQ(bytes[4], 1);
+	EXPECT_EQ(bytes[5], 0);
+	EXPECT_EQ(bytes[8], 2);
+	EXPECT_EQ(bytes[16], 2);
+	EXPECT_EQ(bytes[17], 0);
+	EXPECT_EQ(bytes[24], 0x02);
+	EXPECT_EQ(bytes[25], 0x01);
+}
+
+TEST(Serialize, Errors)
+{
+	using vector = bmstu::simple_vector<int>;
+	using bmstu::serial::format_error;
+	std::string bytes = to_bytes(vector{1, 2, 3});
+
+	std::string wrong_magic = bytes;
+	wrong_magic[0] = 'x';
+	EXPECT_THROW(from_bytes<vector>(wrong_magic), format_error);
+	std::string wrong_version = bytes;
+	wrong_version[4] = 2;
+	EXPECT_THROW(from_bytes<vector>(wrong_version), format_error);
+	EXPECT_THROW(from_bytes<bmstu::list<int>>(bytes), format_error);
+	EXPECT_THROW(from_bytes<bmstu::simple_vector<int64_t>>(bytes),
+				 format_error);
+	EXPECT_THROW(from_bytes<vector>(bytes.substr(0, bytes.size() - 1)),
+				 format_error);
+
+	std::string huge = bytes;
+	std::memset(huge.data() + bmstu::serial::header_size, 0x7f, 8);
+	EXPECT_THROW(from_bytes<vector>(huge), format_error);
+	pipe_buf pipe(huge);
+	std::istream is(&pipe);
+	EXPECT_THROW(bmstu::serial::read<vector>(is), format_error);
+}
+
+TEST(Serialize, PipeReadsInChunks)
+{
+	bmstu::simple_vector<int> v;
+	for (int i = 0; i < 1 << 19; ++i)
+	{
+		v.push_back(i);
+	}
+	pipe_buf pipe(to_bytes(v));
+	std::istream is(&pipe);
+	EXPECT_TRUE(same(bmstu::serial::read<bmstu::simple_vector<int>>(is), v));
+}
+
+TEST(Serialize, ViewInPlace)
+{
+	bmstu::simple_vector<double> v = {0.5, 1.5, 2.5};
+	std::string bytes = to_bytes(v);
+	std::span<const std::byte> buffer = std::as_bytes(std::span(bytes));
+	std::span<const double> view = bmstu::serial::view_vector<double>(buffer);
+	ASSERT_EQ(view.size(), 3u);
+	EXPECT_EQ(view[1], 1.5);
+	EXPECT_EQ(static_cast<const void*>(view.data()),
+			  bytes.data() + bmstu::serial::header_size + 8);
+
+	bmstu::string str = "in place";
+	std::string str_bytes = to_bytes(str);
+	EXPECT_EQ(bmstu::serial::view_string<char>(
+				  std::as_bytes(std::span(str_bytes))),
+			  "in place");
+	EXPECT_THROW(bmstu::serial::view_string<char>(buffer),
+				 bmstu::serial::format_error);
+	EXPECT_THROW(bmstu::serial::view_vector<double>(buffer.first(30)),
+				 bmstu::serial::format_error);
+}
+
+/// Случайные контейнеры проходят запись и чтение без потерь, а порча байтов
+/// приводит только к format_error
+TEST(Serialize, FuzzRoundTrip)
+{
+	using bmstu::serial::format_error;
+	std::mt19937_64 random(46);
+	for (int round = 0; round < 300; ++round)
+	{
+		size_t size = random() % 64;
+		bmstu::simple_vector<uint32_t> numbers;
+		bmstu::list<int16_t> shorts;
+		string_vector words;
+		for (size_t i = 0; i < size; ++i)
+		{
+			numbers.push_back(static_cast<uint32_t>(random()));
+			shorts.push_back(static_cast<int16_t>(random()));
+			bmstu::string word;
+			for (size_t j = random() % 8; j > 0; --j)
+			{
+				word += static_cast<char>(random());
+			}
+			words.push_back(word);
+		}
+		std::string number_bytes = to_bytes(numbers);
+		std::string short_bytes = to_bytes(shorts);
+		std::string word_bytes = to_bytes(words);
+		ASSERT_TRUE(same(
+			from_bytes<bmstu::simple_vector<uint32_t>>(number_bytes), numbers));
+		ASSERT_EQ(from_bytes<bmstu::list<int16_t>>(short_bytes), shorts);
+		ASSERT_TRUE(same(from_bytes<string_vector>(word_bytes), words));
+
+		for (std::string* bytes : {&number_bytes, &short_bytes, &word_bytes})
+		{
+			std::string damaged = *bytes;
+			damaged[random() % damaged.size()] ^=
+				static_cast<char>(1 + random() % 255);
+			damaged.resize(random() % (damaged.size() + 1));
+			try
+			{
+				if (bytes == &number_bytes)
+				{
+					from_bytes<bmstu::simple_vector<uint32_t>>(damaged);
+				}
+				else if (bytes == &short_bytes)
+				{
+					from_bytes<bmstu::list<int16_t>>(damaged);
+				}
+				else
+				{
+					from_bytes<string_vector>(damaged);
+				}
+			}
+			catch (const format_error&)
+			{
+			}
+		}
+	}
+}
@@ -1,7 +1,14 @@
+#pragma once
+#include <algorithm>
+#include <compare>
+#include <iterator>
 #include <ostream>
 #include <stdexcept>
 #include <utility>
 #include "array_ptr.h"
+#include "bmstu_format.h"
+#include "bmstu_hash.h"
+#include "bmstu_stats.h"
 
 namespace bmstu
 {
@@ -24,7 +31,7 @@ class simple_vector
 
 		iterator(std::nullptr_t) noexcept : ptr_(nullptr) {}
 
-		iterator(iterator&& other) noexcept : ptr_(nullptr) {}
+		iterator(iterator&& other) noexcept : ptr_(other.ptr_) {}
 
 		explicit iterator(pointer ptr) : ptr_(ptr) {}
 
@@ -39,27 +46,49 @@ class simple_vector
 
 		iterator& operator=(const iterator& other) = default;
 
-		iterator& operator=(iterator&& other) noexcept { return *this; }
+		iterator& operator=(iterator&& other) noexcept
+		{
+			ptr_ = other.ptr_;
+			return *this;
+		}
 
 #pragma region Operators
-		iterator& operator++() { return *this; }
+		iterator& operator++()
+		{
+			++ptr_;
+			return *this;
+		}
 
-		iterator& operator--() { return *this; }
+		iterator& operator--()
+		{
+			--ptr_;
+			return *this;
+		}
 
-		iterator operator++(int) { return *this; }
+		iterator operator++(int)
+		{
+			iterator copy(*this);
+			++ptr_;
+			return copy;
+		}
 
-		iterator operator--(int) { return *this; }
+		iterator operator--(int)
+		{
+			iterator copy(*this);
+			--ptr_;
+			return copy;
+		}
 
 		explicit operator bool() const { return ptr_ != nullptr; }
 
 		friend bool operator==(const iterator& lhs, const iterator& rhs)
 		{
-			return "false";
+			return lhs.ptr_ == rhs.ptr_;
 		}
 
 		friend bool operator==(const iterator& lhs, std::nullptr_t)
 		{
-			return "false";
+			return lhs.ptr_ == nullptr;
 		}
 
 		iterator& operator=(std::nullptr_t) noexcept
@@ -70,38 +99,40 @@ class simple_vector
 
 		friend bool operator==(std::nullptr_t, const iterator& rhs)
 		{
-			return true;
+			return rhs.ptr_ == nullptr;
 		}
 
 		friend bool operator!=(const iterator& lhs, const iterator& rhs)
 		{
-			return true;
+			return lhs.ptr_ != rhs.ptr_;
 		}
 
 		iterator operator+(const difference_type& n) const noexcept
 		{
-			return nullptr;
+			return iterator(ptr_ + n);
 		}
 
 		iterator operator+=(const difference_type& n) noexcept
 		{
-			return nullptr;
+			ptr_ += n;
+			return *this;
 		}
 
 		iterator operator-(const difference_type& n) const noexcept
 		{
-			return nullptr;
+			return iterator(ptr_ - n);
 		}
 
 		iterator operator-=(const difference_type& n) noexcept
 		{
-			return nullptr;
+			ptr_ -= n;
+			return *this;
 		}
 
 		friend difference_type operator-(const iterator& end,
 										 const iterator& begin) noexcept
 		{
-			return 0;
+			return end.ptr_ - begin.ptr_;
 		}
 
 #pragma endregion
@@ -113,98 +144,294 @@ class simple_vector
 
 	~simple_vector() = default;
 
-	simple_vector(std::initializer_list<T> init) noexcept {}
+	simple_vector(std::initializer_list<T> init) noexcept
+		: data_(allocate_(init.size())),
+		  size_(init.size()),
+		  capacity_(init.size())
+	{
+		std::copy(init.begin(), init.end(), data_.get());
+		stats_hook::element_copies(stats_kind_, size_);
+	}
 
-	simple_vector(const simple_vector& other) {}
+	simple_vector(const simple_vector& other)
+		: data_(allocate_(other.size_)),
+		  size_(other.size_),
+		  capacity_(other.size_)
+	{
+		std::copy(other.begin(), other.end(), data_.get());
+		stats_hook::copy(stats_kind_);
+		stats_hook::element_copies(stats_kind_, size_);
+	}
 
 	simple_vector(simple_vector&& other) noexcept { swap(other); }
 
-	simple_vector& operator=(const simple_vector& other) { return *this; }
+	simple_vector& operator=(const simple_vector& other)
+	{
+		if (this != &other)
+		{
+			simple_vector copy(other);
+			swap(copy);
+		}
+		return *this;
+	}
+
+	simple_vector& operator=(simple_vector&& other) noexcept
+	{
+		if (this != &other)
+		{
+			simple_vector dying(std::move(other));
+			swap(dying);
+		}
+		return *this;
+	}
 
-	simple_vector(size_t size, const T& value = T{}) {}
+	simple_vector(size_t size, const T& value = T{})
+		: data_(allocate_(size)), size_(size), capacity_(size)
+	{
+		std::fill(data_.get(), data_.get() + size_, value);
+		stats_hook::element_copies(stats_kind_, size_);
+	}
 
-	iterator begin() noexcept { return nullptr; }
+	iterator begin() noexcept { return iterator(data_.get()); }
 
-	iterator end() noexcept { return nullptr; }
+	iterator end() noexcept { return iterator(data_.get() + size_); }
 
 	using const_iterator = iterator;
 
-	const_iterator begin() const noexcept { return nullptr; }
+	const_iterator begin() const noexcept { return iterator(data_.get()); }
 
-	const_iterator end() const noexcept { return nullptr; }
+	const_iterator end() const noexcept
+	{
+		return iterator(data_.get() + size_);
+	}
 
 	typename iterator::reference operator[](size_t index) noexcept
 	{
-		return data_[0];
+		return data_[index];
 	}
 
 	typename const_iterator::reference operator[](size_t index) const noexcept
 	{
-		return data_[0];
+		return data_.get()[index];
 	}
 
-	typename iterator::reference at(size_t index) { return data_.get()[1]; }
+	typename iterator::reference at(size_t index)
+	{
+		if (index >= size_)
+		{
+			throw std::out_of_range("Index out of range");
+		}
+		return data_.get()[index];
+	}
 
 	typename const_iterator::reference at(size_t index) const
 	{
-		return data_.get()[1];
+		if (index >= size_)
+		{
+			throw std::out_of_range("Index out of range");
+		}
+		return data_.get()[index];
 	}
 
-	size_t size() const noexcept { return 1; }
+	size_t size() const noexcept { return size_; }
 
-	size_t capacity() const noexcept { return 100500; }
+	size_t capacity() const noexcept { return capacity_; }
 
-	void swap(simple_vector& other) noexcept {}
+	void swap(simple_vector& other) noexcept
+	{
+		data_.swap(other.data_);
+		std::swap(size_, other.size_);
+		std::swap(capacity_, other.capacity_);
+	}
 
-	friend void swap(simple_vector& lhs, simple_vector& rhs) noexcept {}
+	friend void swap(simple_vector& lhs, simple_vector& rhs) noexcept
+	{
+		lhs.swap(rhs);
+	}
 
-	void reserve(size_t new_cap) {}
+	void reserve(size_t new_cap)
+	{
+		if (new_cap > capacity_)
+		{
+			reallocate_(new_cap);
+		}
+	}
 
-	void resize(size_t new_size) { return; }
+	void resize(size_t new_size)
+	{
+		if (new_size > capacity_)
+		{
+			reallocate_(std::max(new_size, capacity_ * 2));
+		}
+		else if (new_size > size_)
+		{
+			std::fill(data_.get() + size_, data_.get() + new_size, T{});
+		}
+		size_ = new_size;
+	}
 
-	iterator insert(const_iterator where, T&& value) { return nullptr; }
+	iterator insert(const_iterator where, T&& value)
+	{
+		size_t index = static_cast<size_t>(where - begin());
+		if (size_ == capacity_)
+		{
+			reallocate_(grown_capacity_());
+		}
+		std::move_backward(data_.get() + index, data_.get() + size_,
+						   data_.get() + size_ + 1);
+		data_[index] = std::move(value);
+		stats_hook::element_moves(stats_kind_, size_ - index + 1);
+		++size_;
+		return begin() + static_cast<std::ptrdiff_t>(index);
+	}
 
-	iterator insert(const_iterator where, const T& value) { return nullptr; }
+	iterator insert(const_iterator where, const T& value)
+	{
+		T copy(value);
+		stats_hook::element_copies(stats_kind_, 1);
+		return insert(where, std::move(copy));
+	}
 
-	void push_back(T&& value) {}
+	void push_back(T&& value)
+	{
+		if (size_ == capacity_)
+		{
+			reallocate_(grown_capacity_());
+		}
+		data_[size_++] = std::move(value);
+		stats_hook::element_moves(stats_kind_, 1);
+	}
 
-	void clear() noexcept {}
+	void clear() noexcept { size_ = 0; }
 
-	void push_back(const T& value) {}
+	void push_back(const T& value)
+	{
+		T copy(value);
+		stats_hook::element_copies(stats_kind_, 1);
+		push_back(std::move(copy));
+	}
 
-	bool empty() const noexcept { return false; }
+	bool empty() const noexcept { return size_ == 0; }
 
-	void pop_back() { return; }
+	void pop_back()
+	{
+		if (size_ > 0)
+		{
+			--size_;
+		}
+	}
 
 	friend bool operator==(const simple_vector& lhs, const simple_vector& rhs)
 	{
-		return true;
+		return lhs.size_ == rhs.size_ &&
+			   std::equal(lhs.begin(), lhs.end(), rhs.begin());
 	}
 
 	friend bool operator!=(const simple_vector& lhs, const simple_vector& rhs)
 	{
-		return false;
+		return !(lhs == rhs);
 	}
 
 	friend auto operator<=>(const simple_vector& lhs, const simple_vector& rhs)
 	{
-		return true;
+		if (alphabet_compare(lhs, rhs))
+		{
+			return std::weak_ordering::less;
+		}
+		if (alphabet_compare(rhs, lhs))
+		{
+			return std::weak_ordering::greater;
+		}
+		return std::weak_ordering::equivalent;
 	}
 
+	/// Элементы через пробел. Числа печатаются одним os.write
 	friend std::ostream& operator<<(std::ostream& os, const simple_vector& vec)
 	{
-		return os;
+		return detail::print_range(os, vec.begin(), vec.end(), "", " ", "");
+	}
+
+	iterator erase(iterator where)
+	{
+		if (size_ == 0)
+		{
+			return end();
+		}
+		if (where == end())
+		{
+			pop_back();
+			return end();
+		}
+		stats_hook::element_moves(stats_kind_,
+								  static_cast<size_t>(end() - where) - 1);
+		std::move(where + 1, end(), where);
+		--size_;
+		return where;
 	}
-	iterator erase(iterator where) { return nullptr; }
 
    private:
 	static bool alphabet_compare(const simple_vector<T>& lhs,
 								 const simple_vector<T>& rhs)
 	{
-		return false;
+		return std::lexicographical_compare(lhs.begin(), lhs.end(),
+											rhs.begin(), rhs.end());
+	}
+
+	/// Новая емкость при нехватке места: 0 -> 1, далее удвоение
+	size_t grown_capacity_() const noexcept
+	{
+		return capacity_ == 0 ? 1 : capacity_ * 2;
+	}
+
+	static constexpr container_kind stats_kind_ = container_kind::simple_vector;
+
+	static array_ptr<T> allocate_(size_t count)
+	{
+		if (count != 0)
+		{
+			stats_hook::allocation(stats_kind_, count * sizeof(T));
+		}
+		return array_ptr<T>(count);
+	}
+
+	void reallocate_(size_t new_cap)
+	{
+		array_ptr<T> fresh = allocate_(new_cap);
+		if (capacity_ != 0)
+		{
+			stats_hook::reallocation(stats_kind_);
+			stats_hook::element_moves(stats_kind_, size_);
+		}
+		std::move(data_.get(), data_.get() + size_, fresh.get());
+		data_.swap(fresh);
+		capacity_ = new_cap;
 	}
 	array_ptr<T> data_;
 	size_t size_ = 0;
 	size_t capacity_ = 0;
 };
 }  // namespace bmstu
+
+template <typename T>
+struct std::hash<bmstu::simple_vector<T>>
+{
+	size_t operator()(const bmstu::simple_vector<T>& vec) const noexcept
+	{
+		return bmstu::hash_contiguous(vec.empty() ? nullptr : &vec[0],
+									  vec.size());
+	}
+};
+
+#if defined(__cpp_lib_format)
+template <typename T, typename CharT>
+struct std::formatter<bmstu::simple_vector<T>, CharT>
+	: bmstu::detail::range_formatter<T, CharT>
+{
+	template <typename FormatContext>
+	typename FormatContext::iterator format(const bmstu::simple_vector<T>& vec,
+											FormatContext& ctx) const
+	{
+		return this->format_range(vec.begin(), vec.end(), "", " ", "", ctx);
+	}
+};
+#endif
@@ -0,0 +1,414 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "bmstu_simple_vector.h"
+
+namespace bmstu
+{
+/// Вектор, в который несколько потоков добавляют элементы одновременно.
+/// Память - сегменты удваивающегося размера (8, 16, 32, ...), поэтому
+/// элементы никогда не переезжают и ссылки на них не инвалидируются.
+/// push_back и grow_by занимают место атомарным счетчиком без блокировок;
+/// элемент виден другим потокам после того, как его конструктор завершился
+/// (published). Место, чей конструктор бросил исключение, остается в size(),
+/// но никогда не публикуется: итерация и snapshot его пропускают, а
+/// operator[] допустим только для опубликованных индексов. clear, reserve
+/// вне гонок, деструктор и итерация - когда писатели закончили
+template <typename T>
+class concurrent_vector
+{
+   public:
+	/// Обход по индексам; Const - только чтение элементов
+	template <bool Const>
+	class basic_iterator
+	{
+		using owner_type = std::conditional_t<Const, const concurrent_vector,
+											  concurrent_vector>;
+
+	   public:
+		using iterator_category = std::forward_iterator_tag;
+		using value_type = T;
+		using pointer = std::conditional_t<Const, const T*, T*>;
+		using reference = std::conditional_t<Const, const T&, T&>;
+		using difference_type = std::ptrdiff_t;
+
+		basic_iterator() = default;
+
+		basic_iterator(owner_type* owner, size_t index) noexcept
+			: owner_(owner), index_(index)
+		{
+			skip_unpublished_();
+		}
+
+		/// iterator приводится к const_iterator
+		operator basic_iterator<true>() const noexcept
+			requires(!Const)
+		{
+			return basic_iterator<true>(owner_, index_);
+		}
+
+		reference operator*() const { return owner_->slot_(index_); }
+
+		pointer operator->() const { return &owner_->slot_(index_); }
+
+		basic_iterator& operator++() noexcept
+		{
+			++index_;
+			skip_unpublished_();
+			return *this;
+		}
+
+		basic_iterator operator++(int) noexcept
+		{
+			basic_iterator copy(*this);
+			++*this;
+			return copy;
+		}
+
+		friend bool operator==(const basic_iterator& lhs,
+							   const basic_iterator& rhs) noexcept
+		{
+			return lhs.index_ == rhs.index_;
+		}
+
+	   private:
+		/// Места, чей конструктор бросил, пропускаются
+		void skip_unpublished_() noexcept
+		{
+			size_t size = owner_->size();
+			while (index_ < size && !owner_->published(index_))
+			{
+				++index_;
+			}
+		}
+
+		owner_type* owner_ = nullptr;
+		size_t index_ = 0;
+	};
+
+	using iterator = basic_iterator<false>;
+	using const_iterator = basic_iterator<true>;
+
+	concurrent_vector() noexcept = default;
+
+	concurrent_vector(std::initializer_list<T> init)
+	{
+		for (const T& value : init)
+		{
+			push_back(value);
+		}
+	}
+
+	concurrent_vector(const concurrent_vector&) = delete;
+	concurrent_vector& operator=(const concurrent_vector&) = delete;
+
+	~concurrent_vector() { clear(); }
+
+	/// Индекс добавленного элемента
+	size_t push_back(const T& value) { return emplace_back(value); }
+
+	size_t push_back(T&& value) { return emplace_back(std::move(value)); }
+
+	template <typename... Args>
+	size_t emplace_back(Args&&... args)
+	{
+		size_t index = size_.fetch_add(1, std::memory_order_relaxed);
+		construct_(index, std::forward<Args>(args)...);
+		return index;
+	}
+
+	/// Занимает count подряд идущих мест и заполняет их копиями value.
+	/// Возвращает индекс первого
+	size_t grow_by(size_t count, const T& value = T())
+	{
+		size_t first = size_.fetch_add(count, std::memory_order_relaxed);
+		size_t last = first + count;
+		for (size_t i = first; i < last;)
+		{
+			// Элементы до конца слова маски (или сегмента, первые сегменты
+			// короче слова) публикуются одним fetch_or
+			auto [segment, offset] = locate_(i);
+			size_t n = std::min({last - i, 64 - offset % 64,
+								 segment_size_(segment) - offset});
+			std::byte* memory = segment_memory_(segment);
+			T* elements = elements_(memory, segment);
+			uint64_t built = 0;
+			try
+			{
+				for (size_t k = 0; k < n; ++k)
+				{
+					new (elements + offset + k) T(value);
+					built |= uint64_t{1} << ((offset + k) % 64);
+				}
+			}
+			catch (...)
+			{
+				publish_(memory, offset, built);
+				throw;
+			}
+			publish_(memory, offset, built);
+			i += n;
+		}
+		return first;
+	}
+
+	/// Число занятых мест. Элементы среди них могут еще конструироваться
+	/// другими потоками или не построиться вовсе, см. published
+	size_t size() const noexcept
+	{
+		return size_.load(std::memory_order_acquire);
+	}
+
+	bool empty() const noexcept { return size() == 0; }
+
+	/// Элемент index построен, и его можно читать из любого потока
+	bool published(size_t index) const noexcept
+	{
+		if (index >= size())
+		{
+			return false;
+		}
+		auto [segment, offset] = locate_(index);
+		std::byte* memory = segments_[segment].load(std::memory_order_acquire);
+		if (memory == nullptr)
+		{
+			return false;
+		}
+		uint64_t bits =
+			ready_bits_(memory)[offset / 64].load(std::memory_order_acquire);
+		return ((bits >> (offset % 64)) & 1) != 0;
+	}
+
+	T& operator[](size_t index) noexcept { return slot_(index); }
+
+	const T& operator[](size_t index) const noexcept { return slot_(index); }
+
+	T& at(size_t index)
+	{
+		if (!published(index))
+		{
+			throw std::out_of_range("Index out of range");
+		}
+		return slot_(index);
+	}
+
+	const T& at(size_t index) const
+	{
+		if (!published(index))
+		{
+			throw std::out_of_range("Index out of range");
+		}
+		return slot_(index);
+	}
+
+	iterator begin() noexcept { return iterator(this, 0); }
+
+	iterator end() noexcept { return iterator(this, size()); }
+
+	const_iterator begin() const noexcept { return const_iterator(this, 0); }
+
+	const_iterator end() const noexcept
+	{
+		return const_iterator(this, size());
+	}
+
+	const_iterator cbegin() const noexcept { return begin(); }
+
+	const_iterator cend() const noexcept { return end(); }
+
+	/// Заранее выделяет сегменты под count элементов
+	void reserve(size_t count)
+	{
+		if (count == 0)
+		{
+			return;
+		}
+		size_t last = locate_(count - 1).first;
+		for (size_t segment = 0; segment <= last; ++segment)
+		{
+			segment_memory_(segment);
+		}
+	}
+
+	/// Сумма размеров выделенных сегментов
+	size_t capacity() const noexcept
+	{
+		size_t total = 0;
+		for (size_t segment = 0; segment < segment_count_; ++segment)
+		{
+			if (segments_[segment].load(std::memory_order_acquire) != nullptr)
+			{
+				total += segment_size_(segment);
+			}
+		}
+		return total;
+	}
+
+	/// Разрушает опубликованные элементы и освобождает сегменты
+	void clear() noexcept
+	{
+		for (size_t segment = 0; segment < segment_count_; ++segment)
+		{
+			std::byte* memory =
+				segments_[segment].exchange(nullptr, std::memory_order_acquire);
+			if (memory != nullptr)
+			{
+				destroy_segment_(segment, memory);
+			}
+		}
+		size_.store(0, std::memory_order_release);
+	}
+
+	/// Копия опубликованных элементов в обычный simple_vector
+	simple_vector<T> snapshot() const
+	{
+		simple_vector<T> result;
+		size_t count = size();
+		result.reserve(count);
+		for (size_t i = 0; i < count; ++i)
+		{
+			if (published(i))
+			{
+				result.push_back(slot_(i));
+			}
+		}
+		return result;
+	}
+
+   private:
+	static constexpr size_t first_segment_log_ = 3;
+	static constexpr size_t first_segment_ = size_t{1} << first_segment_log_;
+	static constexpr size_t segment_count_ =
+		std::numeric_limits<size_t>::digits - first_segment_log_;
+	using ready_word = std::atomic<uint64_t>;
+	static constexpr size_t align_ =
+		std::max(alignof(T), alignof(ready_word));
+
+	static constexpr size_t segment_size_(size_t segment) noexcept
+	{
+		return first_segment_ << segment;
+	}
+
+	/// Сегмент и смещение в нем: сегмент k начинается с 8 * (2^k - 1)
+	static std::pair<size_t, size_t> locate_(size_t index) noexcept
+	{
+		size_t shifted = index + first_segment_;
+		size_t segment = static_cast<size_t>(std::bit_width(shifted)) - 1 -
+						 first_segment_log_;
+		return {segment, shifted - segment_size_(segment)};
+	}
+
+	/// Сегмент: битовая маска построенных элементов, затем сами элементы
+	static size_t bits_bytes_(size_t segment) noexcept
+	{
+		size_t words = (segment_size_(segment) + 63) / 64;
+		size_t bytes = words * sizeof(ready_word);
+		return (bytes + alignof(T) - 1) / alignof(T) * alignof(T);
+	}
+
+	static size_t segment_bytes_(size_t segment) noexcept
+	{
+		return bits_bytes_(segment) + segment_size_(segment) * sizeof(T);
+	}
+
+	static ready_word* ready_bits_(std::byte* memory) noexcept
+	{
+		return std::launder(reinterpret_cast<ready_word*>(memory));
+	}
+
+	static T* elements_(std::byte* memory, size_t segment) noexcept
+	{
+		return reinterpret_cast<T*>(memory + bits_bytes_(segment));
+	}
+
+	/// Память сегмента; первый поток, которому она нужна, выделяет ее,
+	/// проигравшие гонку освобождают свою копию
+	std::byte* segment_memory_(size_t segment)
+	{
+		std::byte* memory = segments_[segment].load(std::memory_order_acquire);
+		if (memory != nullptr)
+		{
+			return memory;
+		}
+		std::byte* fresh = static_cast<std::byte*>(::operator new(
+			segment_bytes_(segment), std::align_val_t(align_)));
+		size_t words = (segment_size_(segment) + 63) / 64;
+		for (size_t i = 0; i < words; ++i)
+		{
+			new (fresh + i * sizeof(ready_word)) ready_word(0);
+		}
+		if (segments_[segment].compare_exchange_strong(
+				memory, fresh, std::memory_order_acq_rel,
+				std::memory_order_acquire))
+		{
+			return fresh;
+		}
+		::operator delete(fresh, std::align_val_t(align_));
+		return memory;
+	}
+
+	template <typename... Args>
+	void construct_(size_t index, Args&&... args)
+	{
+		auto [segment, offset] = locate_(index);
+		std::byte* memory = segment_memory_(segment);
+		T* slot = elements_(memory, segment) + offset;
+		new (slot) T(std::forward<Args>(args)...);
+		publish_(memory, offset, uint64_t{1} << (offset % 64));
+	}
+
+	static void publish_(std::byte* memory, size_t offset, uint64_t bits)
+	{
+		ready_bits_(memory)[offset / 64].fetch_or(bits,
+												  std::memory_order_release);
+	}
+
+	T& slot_(size_t index) noexcept { return *slot_pointer_(index); }
+
+	const T& slot_(size_t index) const noexcept
+	{
+		return *slot_pointer_(index);
+	}
+
+	T* slot_pointer_(size_t index) const noexcept
+	{
+		auto [segment, offset] = locate_(index);
+		std::byte* memory = segments_[segment].load(std::memory_order_acquire);
+		return std::launder(elements_(memory, segment) + offset);
+	}
+
+	static void destroy_segment_(size_t segment, std::byte* memory) noexcept
+	{
+		size_t words = (segment_size_(segment) + 63) / 64;
+		T* elements = elements_(memory, segment);
+		for (size_t word = 0; word < words; ++word)
+		{
+			uint64_t bits =
+				ready_bits_(memory)[word].load(std::memory_order_acquire);
+			while (bits != 0)
+			{
+				size_t bit = static_cast<size_t>(std::countr_zero(bits));
+				std::destroy_at(elements + word * 64 + bit);
+				bits &= bits - 1;
+			}
+			ready_bits_(memory)[word].~ready_word();
+		}
+		::operator delete(memory, std::align_val_t(align_));
+	}
+
+	std::atomic<size_t> size_{0};
+	std::array<std::atomic<std::byte*>, segment_count_> segments_{};
+};
+}  // namespace bmstu
@@ -0,0 +1,214 @@
+#include "concurrent_vector.h"
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+TEST(ConcurrentVector, PushBackAndIndex)
+{
+	bmstu::concurrent_vector<std::string> v;
+	ASSERT_TRUE(v.empty());
+	for (int i = 0; i < 100; ++i)
+	{
+		ASSERT_EQ(v.push_back(std::to_string(i)), static_cast<size_t>(i));
+	}
+	ASSERT_EQ(v.size(), 100u);
+	ASSERT_EQ(v[0], "0");
+	ASSERT_EQ(v[7], "7");
+	ASSERT_EQ(v[8], "8");
+	ASSERT_EQ(v.at(99), "99");
+	ASSERT_THROW(v.at(100), std::out_of_range);
+	ASSERT_FALSE(v.published(100));
+	ASSERT_EQ(std::count_if(v.begin(), v.end(),
+							[](const std::string& s) { return s.size() == 2; }),
+			  90);
+}
+
+TEST(ConcurrentVector, ConstIteration)
+{
+	bmstu::concurrent_vector<int> v = {1, 2, 3};
+	const bmstu::concurrent_vector<int>& view = v;
+	static_assert(std::is_same_v<decltype(*view.begin()), const int&>);
+	static_assert(std::is_same_v<decltype(view[0]), const int&>);
+	static_assert(std::is_same_v<decltype(*v.begin()), int&>);
+	bmstu::concurrent_vector<int>::const_iterator it = v.begin();
+	ASSERT_EQ(*it, 1);
+	ASSERT_EQ(it, view.cbegin());
+	for (int& x : v)
+	{
+		x *= 10;
+	}
+	ASSERT_EQ(std::count(view.begin(), view.end(), 20), 1);
+}
+
+TEST(ConcurrentVector, ElementsNeverMove)
+{
+	bmstu::concurrent_vector<int> v = {1, 2, 3};
+	int* first = &v[0];
+	int* third = &v[2];
+	for (int i = 0; i < 100000; ++i)
+	{
+		v.push_back(i);
+	}
+	ASSERT_EQ(first, &v[0]);
+	ASSERT_EQ(third, &v[2]);
+	ASSERT_EQ(*third, 3);
+	ASSERT_EQ(v[99999 + 3], 99999);
+}
+
+TEST(ConcurrentVector, GrowByAndReserve)
+{
+	bmstu::concurrent_vector<int> v;
+	v.reserve(100);
+	ASSERT_GE(v.capacity(), 100u);
+	ASSERT_EQ(v.size(), 0u);
+	ASSERT_EQ(v.grow_by(5, 7), 0u);
+	ASSERT_EQ(v.grow_by(20), 5u);
+	ASSERT_EQ(v.size(), 25u);
+	ASSERT_EQ(v[4], 7);
+	ASSERT_EQ(v[24], 0);
+	bmstu::simple_vector<int> copy = v.snapshot();
+	ASSERT_EQ(copy.size(), 25u);
+	ASSERT_EQ(copy[0], 7);
+	v.clear();
+	ASSERT_TRUE(v.empty());
+	ASSERT_EQ(v.capacity(), 0u);
+}
+
+TEST(ConcurrentVector, DestroysElements)
+{
+	auto counter = std::make_shared<int>(0);
+	{
+		bmstu::concurrent_vector<std::shared_ptr<int>> v;
+		v.grow_by(1000, counter);
+		ASSERT_EQ(counter.use_count(), 1001);
+	}
+	ASSERT_EQ(counter.use_count(), 1);
+}
+
+namespace
+{
+/// Конструктор из отрицательного числа бросает, копирование бросает,
+/// когда copies_left доходит до нуля
+struct fragile
+{
+	fragile() = default;
+
+	explicit fragile(int v) : value(v)
+	{
+		if (v < 0)
+		{
+			throw std::runtime_error("negative");
+		}
+	}
+
+	fragile(const fragile& other) : value(other.value)
+	{
+		if (copies_left-- == 0)
+		{
+			throw std::runtime_error("copy");
+		}
+	}
+
+	fragile& operator=(const fragile&) = default;
+
+	int value = 0;
+	static inline int copies_left = 1000;
+};
+}  // namespace
+
+TEST(ConcurrentVector, ThrowingConstructorLeavesHole)
+{
+	bmstu::concurrent_vector<fragile> v;
+	v.emplace_back(0);
+	v.emplace_back(1);
+	ASSERT_THROW(v.emplace_back(-1), std::runtime_error);
+	v.emplace_back(3);
+	ASSERT_EQ(v.size(), 4u);
+	ASSERT_FALSE(v.published(2));
+	ASSERT_THROW(v.at(2), std::out_of_range);
+
+	fragile::copies_left = 3;
+	ASSERT_THROW(v.grow_by(5, fragile(9)), std::runtime_error);
+	ASSERT_EQ(v.size(), 9u);
+	fragile::copies_left = 1000;
+
+	std::vector<int> values;
+	for (const fragile& f : v)
+	{
+		values.push_back(f.value);
+	}
+	ASSERT_EQ(values, (std::vector<int>{0, 1, 3, 9, 9, 9}));
+	bmstu::simple_vector<fragile> copy = v.snapshot();
+	ASSERT_EQ(copy.size(), 6u);
+	ASSERT_EQ(copy[2].value, 3);
+}
+
+TEST(ConcurrentVector, ConcurrentAppends)
+{
+	constexpr int threads = 8;
+	constexpr int per_thread = 20000;
+	bmstu::concurrent_vector<int> v;
+	std::atomic<size_t> seen_published{0};
+	std::vector<std::thread> writers;
+	for (int t = 0; t < threads; ++t)
+	{
+		writers.emplace_back(
+			[&, t]
+			{
+				for (int i = 0; i < per_thread; ++i)
+				{
+					int value = t * per_thread + i;
+					if (i % 2 == 0)
+					{
+						v.push_back(value);
+					}
+					else
+					{
+						size_t first = v.grow_by(1, value);
+						// Свой элемент виден сразу после grow_by
+						if (v.published(first) && v[first] == value)
+						{
+							seen_published.fetch_add(1);
+						}
+					}
+				}
+			});
+	}
+	// Читатель во время записи видит только построенные элементы
+	std::thread reader(
+		[&]
+		{
+			for (int round = 0; round < 100; ++round)
+			{
+				size_t size = v.size();
+				for (size_t i = 0; i < size; ++i)
+				{
+					if (v.published(i))
+					{
+						ASSERT_LT(v[i], threads * per_thread);
+					}
+				}
+			}
+		});
+	for (std::thread& writer : writers)
+	{
+		writer.join();
+	}
+	reader.join();
+	ASSERT_EQ(v.size(), static_cast<size_t>(threads * per_thread));
+	ASSERT_EQ(seen_published.load(),
+			  static_cast<size_t>(threads * per_thread / 2));
+	std::vector<int> values(v.begin(), v.end());
+	std::sort(values.begin(), values.end());
+	for (int i = 0; i < threads * per_thread; ++i)
+	{
+		ASSERT_EQ(values[i], i);
+	}
+}
@@ -1,9 +1,12 @@
 #include "bmstu_simple_vector.h"
+#include "alloc_tracker.h"
 
 #include <gtest/gtest.h>
 #include <algorithm>
 #include <numeric>
 #include <sstream>
+#include <string>
+#include <unordered_set>
 
 TEST(SimpleVector, DefaultConstructor)
 {
@@ -480,3 +483,63 @@ TEST(SimpleVector, PushBackCopyMove3)
 	auto it = v.begin();
 	it = nullptr;
 }
+
+TEST(SimpleVector, Hash)
+{
+	std::unordered_set<bmstu::simple_vector<int>> set;
+	set.insert(bmstu::simple_vector<int>{1, 2, 3});
+	set.insert(bmstu::simple_vector<int>{1, 2, 3});
+	set.insert(bmstu::simple_vector<int>{3, 2, 1});
+	set.insert(bmstu::simple_vector<int>{});
+	ASSERT_EQ(set.size(), 3);
+}
+
+TEST(SimpleVector, HashNonTrivial)
+{
+	using namespace std::string_literals;
+	std::hash<bmstu::simple_vector<std::string>> hasher;
+	ASSERT_EQ(hasher(bmstu::simple_vector<std::string>{"a"s, "bc"s}),
+			  hasher(bmstu::simple_vector<std::string>{"a"s, "bc"s}));
+	ASSERT_NE(hasher(bmstu::simple_vector<std::string>{"a"s, "bc"s}),
+			  hasher(bmstu::simple_vector<std::string>{"ab"s, "c"s}));
+}
+
+TEST(SimpleVector, AllocationBudget)
+{
+	bmstu::simple_vector<int> v;
+	EXPECT_ALLOCS(1, {
+		v.reserve(1000);
+		for (int i = 0; i < 1000; ++i)
+		{
+			v.push_back(i);
+		}
+	});
+	EXPECT_ALLOCS(0, bmstu::simple_vector<int> moved(std::move(v)));
+	bmstu::simple_vector<int> grown;
+	// Удвоение емкости: 1, 2, 4, ..., 1024
+	EXPECT_MAX_ALLOCS(11, for (int i = 0; i < 1000; ++i) grown.push_back(i));
+}
+
+TEST(SimpleVector, PrintNumbers)
+{
+	bmstu::simple_vector<double> v = {0.5, 1.0 / 3, 1e20, -7};
+	std::ostringstream os;
+	os << v;
+	ASSERT_EQ(os.str(), "0.5 0.333333 1e+20 -7");
+	bmstu::simple_vector<int> hex = {10, 255};
+	std::ostringstream hex_os;
+	hex_os << std::hex << hex;
+	ASSERT_EQ(hex_os.str(), "a ff");
+	std::ostringstream empty;
+	empty << bmstu::simple_vector<int>{};
+	ASSERT_EQ(empty.str(), "");
+}
+
+#if defined(__cpp_lib_format)
+TEST(SimpleVector, Format)
+{
+	bmstu::simple_vector<int> v = {1, 10, 255};
+	ASSERT_EQ(std::format("{}", v), "1 10 255");
+	ASSERT_EQ(std::format("[{:02x}]", v), "[01 0a ff]");
+}
+#endif
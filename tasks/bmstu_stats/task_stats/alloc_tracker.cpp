@@ -0,0 +1,148 @@
+#include "alloc_tracker.h"
+
+#include <cstdlib>
+#include <new>
+#ifdef _MSC_VER
+#include <malloc.h>
+#endif
+
+namespace
+{
+thread_local size_t allocations = 0;
+thread_local size_t bytes = 0;
+
+void* tracked_alloc(size_t size, size_t alignment) noexcept
+{
+	++allocations;
+	bytes += size;
+	if (size == 0)
+	{
+		size = 1;
+	}
+	if (alignment <= __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+	{
+		return std::malloc(size);
+	}
+#ifdef _MSC_VER
+	return _aligned_malloc(size, alignment);
+#else
+	// aligned_alloc требует размер, кратный выравниванию
+	return std::aligned_alloc(alignment,
+							  (size + alignment - 1) & ~(alignment - 1));
+#endif
+}
+
+void* tracked_alloc_or_throw(size_t size, size_t alignment)
+{
+	void* ptr = tracked_alloc(size, alignment);
+	if (ptr == nullptr)
+	{
+		throw std::bad_alloc();
+	}
+	return ptr;
+}
+
+void tracked_free(void* ptr, size_t alignment) noexcept
+{
+#ifdef _MSC_VER
+	if (alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+	{
+		_aligned_free(ptr);
+		return;
+	}
+#endif
+	(void)alignment;
+	std::free(ptr);
+}
+
+constexpr size_t default_alignment = __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+}  // namespace
+
+namespace bmstu::testing
+{
+size_t allocation_count() noexcept { return allocations; }
+
+size_t allocated_bytes() noexcept { return bytes; }
+}  // namespace bmstu::testing
+
+void* operator new(size_t size)
+{
+	return tracked_alloc_or_throw(size, default_alignment);
+}
+
+void* operator new[](size_t size)
+{
+	return tracked_alloc_or_throw(size, default_alignment);
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept
+{
+	return tracked_alloc(size, default_alignment);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept
+{
+	return tracked_alloc(size, default_alignment);
+}
+
+void* operator new(size_t size, std::align_val_t alignment)
+{
+	return tracked_alloc_or_throw(size, static_cast<size_t>(alignment));
+}
+
+void* operator new[](size_t size, std::align_val_t alignment)
+{
+	return tracked_alloc_or_throw(size, static_cast<size_t>(alignment));
+}
+
+void* operator new(size_t size, std::align_val_t alignment,
+				   const std::nothrow_t&) noexcept
+{
+	return tracked_alloc(size, static_cast<size_t>(alignment));
+}
+
+void* operator new[](size_t size, std::align_val_t alignment,
+					 const std::nothrow_t&) noexcept
+{
+	return tracked_alloc(size, static_cast<size_t>(alignment));
+}
+
+void operator delete(void* ptr) noexcept
+{
+	tracked_free(ptr, default_alignment);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+	tracked_free(ptr, default_alignment);
+}
+
+void operator delete(void* ptr, size_t) noexcept
+{
+	tracked_free(ptr, default_alignment);
+}
+
+void operator delete[](void* ptr, size_t) noexcept
+{
+	tracked_free(ptr, default_alignment);
+}
+
+void operator delete(void* ptr, std::align_val_t alignment) noexcept
+{
+	tracked_free(ptr, static_cast<size_t>(alignment));
+}
+
+void operator delete[](void* ptr, std::align_val_t alignment) noexcept
+{
+	tracked_free(ptr, static_cast<size_t>(alignment));
+}
+
+void operator delete(void* ptr, size_t, std::align_val_t alignment) noexcept
+{
+	tracked_free(ptr, static_cast<size_t>(alignment));
+}
+
+void operator delete[](void* ptr, size_t, std::align_val_t alignment) noexcept
+{
+	tracked_free(ptr, static_cast<size_t>(alignment));
+}
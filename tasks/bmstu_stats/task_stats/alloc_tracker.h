@@ -0,0 +1,57 @@
+#pragma once
+#include <cstddef>
+
+/// Учет вызовов operator new в тестах. Замены глобальных operator new и
+/// delete лежат в alloc_tracker.cpp, который подключается к тестовым
+/// исполняемым файлам. Счетчики свои у каждого потока, поэтому фоновые
+/// потоки не портят замеры
+
+namespace bmstu::testing
+{
+/// Выделений и байт в текущем потоке с его начала
+size_t allocation_count() noexcept;
+size_t allocated_bytes() noexcept;
+
+/// Выделения текущего потока с момента создания объекта
+class alloc_scope
+{
+   public:
+	alloc_scope() noexcept
+		: allocations_(allocation_count()), bytes_(allocated_bytes())
+	{
+	}
+
+	size_t allocations() const noexcept
+	{
+		return allocation_count() - allocations_;
+	}
+
+	size_t bytes() const noexcept { return allocated_bytes() - bytes_; }
+
+   private:
+	size_t allocations_;
+	size_t bytes_;
+};
+}  // namespace bmstu::testing
+
+/// EXPECT_MAX_ALLOCS(n, код): код выделил память не больше n раз,
+/// EXPECT_ALLOCS(n, код) - ровно n раз. Код может быть блоком { ... }
+#define BMSTU_CHECK_ALLOCS_(check, op, n, ...)              \
+	do                                                      \
+	{                                                       \
+		size_t bmstu_allocs_ = 0;                           \
+		{                                                   \
+			::bmstu::testing::alloc_scope bmstu_scope_;     \
+			__VA_ARGS__;                                    \
+			bmstu_allocs_ = bmstu_scope_.allocations();     \
+		}                                                   \
+		check##_##op(bmstu_allocs_, static_cast<size_t>(n)) \
+			<< "allocations in: " #__VA_ARGS__;             \
+	} while (false)
+
+#define EXPECT_MAX_ALLOCS(n, ...) \
+	BMSTU_CHECK_ALLOCS_(EXPECT, LE, n, __VA_ARGS__)
+#define ASSERT_MAX_ALLOCS(n, ...) \
+	BMSTU_CHECK_ALLOCS_(ASSERT, LE, n, __VA_ARGS__)
+#define EXPECT_ALLOCS(n, ...) BMSTU_CHECK_ALLOCS_(EXPECT, EQ, n, __VA_ARGS__)
+#define ASSERT_ALLOCS(n, ...) BMSTU_CHECK_ALLOCS_(ASSERT, EQ, n, __VA_ARGS__)
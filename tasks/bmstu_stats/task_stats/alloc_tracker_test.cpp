@@ -0,0 +1,51 @@
+#include <gtest/gtest-spi.h>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "alloc_tracker.h"
+
+TEST(AllocTrackerTest, CountsNewAndDelete)
+{
+	bmstu::testing::alloc_scope scope;
+	// Пары new/delete в выражениях компилятор вправе выбросить
+	void* value = ::operator new(sizeof(int));
+	::operator delete(value);
+	void* values = ::operator new[](10 * sizeof(int));
+	::operator delete[](values);
+	ASSERT_EQ(scope.allocations(), 2u);
+	ASSERT_EQ(scope.bytes(), 11 * sizeof(int));
+}
+
+TEST(AllocTrackerTest, OverAligned)
+{
+	struct alignas(64) block
+	{
+		char data[64];
+	};
+	EXPECT_ALLOCS(1, {
+		auto ptr = std::make_unique<block>();
+		ASSERT_EQ(reinterpret_cast<uintptr_t>(ptr.get()) % 64, 0u);
+	});
+}
+
+TEST(AllocTrackerTest, OtherThreadsIgnored)
+{
+	EXPECT_ALLOCS(1, {
+		std::thread worker(
+			[]
+			{
+				std::vector<int> noise(100);
+				(void)noise;
+			});
+		worker.join();
+	});
+}
+
+TEST(AllocTrackerTest, BudgetFailure)
+{
+	EXPECT_NONFATAL_FAILURE(EXPECT_MAX_ALLOCS(0, std::vector<int> v(10)),
+							"allocations in: std::vector<int> v(10)");
+}
@@ -0,0 +1,241 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <ostream>
+#include <sstream>
+
+/// Счетчики операций контейнеров bmstu. Включаются макросом BMSTU_STATS
+/// (опция CMake BMSTU_STATS), без него хуки пустые и вырезаются
+/// компилятором, а снимок всегда нулевой
+
+namespace bmstu
+{
+#if defined(BMSTU_STATS)
+inline constexpr bool stats_enabled = true;
+#else
+inline constexpr bool stats_enabled = false;
+#endif
+
+enum class container_kind
+{
+	simple_vector,
+	list,
+	string
+};
+
+inline constexpr size_t container_kind_count = 3;
+
+inline const char* container_kind_name(container_kind kind) noexcept
+{
+	switch (kind)
+	{
+		case container_kind::simple_vector:
+			return "simple_vector";
+		case container_kind::list:
+			return "list";
+		case container_kind::string:
+			return "basic_string";
+	}
+	return "?";
+}
+
+/// Счетчики одного вида контейнеров
+struct container_stats
+{
+	/// Выделений памяти и выделено байт всего
+	uint64_t allocations = 0;
+	uint64_t bytes = 0;
+	/// Переездов занятого буфера в новый
+	uint64_t reallocations = 0;
+	/// Копирований целого контейнера
+	uint64_t copies = 0;
+	uint64_t element_copies = 0;
+	uint64_t element_moves = 0;
+
+	friend bool operator==(const container_stats&,
+						   const container_stats&) = default;
+};
+
+namespace detail
+{
+struct stats_counters
+{
+	std::atomic<uint64_t> allocations{0};
+	std::atomic<uint64_t> bytes{0};
+	std::atomic<uint64_t> reallocations{0};
+	std::atomic<uint64_t> copies{0};
+	std::atomic<uint64_t> element_copies{0};
+	std::atomic<uint64_t> element_moves{0};
+};
+
+inline std::array<stats_counters, container_kind_count> stats_storage;
+
+inline stats_counters& stats_of(container_kind kind) noexcept
+{
+	return stats_storage[static_cast<size_t>(kind)];
+}
+
+inline void stats_add(std::atomic<uint64_t>& counter, uint64_t n) noexcept
+{
+	counter.fetch_add(n, std::memory_order_relaxed);
+}
+}  // namespace detail
+
+/// Снимок счетчиков всех контейнеров:
+/// bmstu::stats::snapshot()[bmstu::container_kind::list].allocations
+class stats
+{
+   public:
+	static stats snapshot() noexcept
+	{
+		stats result;
+		for (size_t i = 0; i < container_kind_count; ++i)
+		{
+			const detail::stats_counters& c = detail::stats_storage[i];
+			result.kinds_[i] = {
+				c.allocations.load(std::memory_order_relaxed),
+				c.bytes.load(std::memory_order_relaxed),
+				c.reallocations.load(std::memory_order_relaxed),
+				c.copies.load(std::memory_order_relaxed),
+				c.element_copies.load(std::memory_order_relaxed),
+				c.element_moves.load(std::memory_order_relaxed)};
+		}
+		return result;
+	}
+
+	static void reset() noexcept
+	{
+		for (detail::stats_counters& c : detail::stats_storage)
+		{
+			c.allocations.store(0, std::memory_order_relaxed);
+			c.bytes.store(0, std::memory_order_relaxed);
+			c.reallocations.store(0, std::memory_order_relaxed);
+			c.copies.store(0, std::memory_order_relaxed);
+			c.element_copies.store(0, std::memory_order_relaxed);
+			c.element_moves.store(0, std::memory_order_relaxed);
+		}
+	}
+
+	const container_stats& operator[](container_kind kind) const noexcept
+	{
+		return kinds_[static_cast<size_t>(kind)];
+	}
+
+	/// Разница двух снимков - счетчики участка кода между ними
+	friend stats operator-(const stats& after, const stats& before) noexcept
+	{
+		stats result;
+		for (size_t i = 0; i < container_kind_count; ++i)
+		{
+			const container_stats& a = after.kinds_[i];
+			const container_stats& b = before.kinds_[i];
+			result.kinds_[i] = {a.allocations - b.allocations,
+								a.bytes - b.bytes,
+								a.reallocations - b.reallocations,
+								a.copies - b.copies,
+								a.element_copies - b.element_copies,
+								a.element_moves - b.element_moves};
+		}
+		return result;
+	}
+
+	bool empty() const noexcept
+	{
+		for (const container_stats& kind : kinds_)
+		{
+			if (kind != container_stats{})
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	friend std::ostream& operator<<(std::ostream& os, const stats& s)
+	{
+		for (size_t i = 0; i < container_kind_count; ++i)
+		{
+			const container_stats& k = s.kinds_[i];
+			os << container_kind_name(static_cast<container_kind>(i))
+			   << ": allocations=" << k.allocations << " bytes=" << k.bytes
+			   << " reallocations=" << k.reallocations
+			   << " copies=" << k.copies
+			   << " element_copies=" << k.element_copies
+			   << " element_moves=" << k.element_moves << '\n';
+		}
+		return os;
+	}
+
+   private:
+	std::array<container_stats, container_kind_count> kinds_{};
+};
+
+/// Хуки, которые вызывают контейнеры
+namespace stats_hook
+{
+inline void allocation(container_kind kind, size_t bytes) noexcept
+{
+	if constexpr (stats_enabled)
+	{
+		detail::stats_add(detail::stats_of(kind).allocations, 1);
+		detail::stats_add(detail::stats_of(kind).bytes, bytes);
+	}
+}
+
+inline void reallocation(container_kind kind) noexcept
+{
+	if constexpr (stats_enabled)
+	{
+		detail::stats_add(detail::stats_of(kind).reallocations, 1);
+	}
+}
+
+inline void copy(container_kind kind) noexcept
+{
+	if constexpr (stats_enabled)
+	{
+		detail::stats_add(detail::stats_of(kind).copies, 1);
+	}
+}
+
+inline void element_copies(container_kind kind, size_t count) noexcept
+{
+	if constexpr (stats_enabled)
+	{
+		detail::stats_add(detail::stats_of(kind).element_copies, count);
+	}
+}
+
+inline void element_moves(container_kind kind, size_t count) noexcept
+{
+	if constexpr (stats_enabled)
+	{
+		detail::stats_add(detail::stats_of(kind).element_moves, count);
+	}
+}
+}  // namespace stats_hook
+
+#if defined(BMSTU_STATS)
+namespace detail
+{
+/// Печать в stderr при выходе, если что-то было посчитано
+inline const bool stats_dump_registered =
+	(std::atexit(
+		 []
+		 {
+			 stats snapshot = stats::snapshot();
+			 if (!snapshot.empty())
+			 {
+				 std::ostringstream text;
+				 text << "bmstu::stats\n" << snapshot;
+				 std::fputs(text.str().c_str(), stderr);
+			 }
+		 }),
+	 true);
+}  // namespace detail
+#endif
+}  // namespace bmstu
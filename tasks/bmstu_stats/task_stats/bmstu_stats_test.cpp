@@ -0,0 +1,113 @@
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <string>
+#include "bmstu_list.h"
+#include "bmstu_simple_vector.h"
+#include "bmstu_stats.h"
+#include "bmstu_string.h"
+
+using bmstu::container_kind;
+
+TEST(StatsTest, Enabled) { ASSERT_TRUE(bmstu::stats_enabled); }
+
+TEST(StatsTest, SimpleVectorGrowth)
+{
+	bmstu::stats before = bmstu::stats::snapshot();
+	{
+		bmstu::simple_vector<int> v;
+		for (int i = 0; i < 5; ++i)
+		{
+			v.push_back(i);
+		}
+		bmstu::simple_vector<int> copy(v);
+	}
+	bmstu::container_stats s =
+		(bmstu::stats::snapshot() - before)[container_kind::simple_vector];
+	// Емкость 1, 2, 4, 8 и буфер копии
+	ASSERT_EQ(s.allocations, 5u);
+	ASSERT_EQ(s.bytes, (1 + 2 + 4 + 8 + 5) * sizeof(int));
+	ASSERT_EQ(s.reallocations, 3u);
+	ASSERT_EQ(s.copies, 1u);
+	// 5 значений в push_back и 5 элементов копии
+	ASSERT_EQ(s.element_copies, 10u);
+	// 5 вставок и переезды 1 + 2 + 4 элемента
+	ASSERT_EQ(s.element_moves, 12u);
+}
+
+TEST(StatsTest, SimpleVectorReserve)
+{
+	bmstu::stats before = bmstu::stats::snapshot();
+	bmstu::simple_vector<int> v;
+	v.reserve(100);
+	for (int i = 0; i < 100; ++i)
+	{
+		v.push_back(std::move(i));
+	}
+	bmstu::container_stats s =
+		(bmstu::stats::snapshot() - before)[container_kind::simple_vector];
+	ASSERT_EQ(s.allocations, 1u);
+	ASSERT_EQ(s.reallocations, 0u);
+	ASSERT_EQ(s.element_copies, 0u);
+}
+
+TEST(StatsTest, ListNodes)
+{
+	bmstu::stats before = bmstu::stats::snapshot();
+	bmstu::list<int> l;
+	l.push_back(1);
+	l.push_front(0);
+	bmstu::list<int> copy(l);
+	bmstu::container_stats s =
+		(bmstu::stats::snapshot() - before)[container_kind::list];
+	// По два служебных узла на список и по узлу на элемент. Литерал в
+	// push_back переносится, остальные значения копируются
+	ASSERT_EQ(s.allocations, 8u);
+	ASSERT_EQ(s.copies, 1u);
+	ASSERT_EQ(s.element_copies, 3u);
+	ASSERT_EQ(s.element_moves, 1u);
+	ASSERT_EQ(s.reallocations, 0u);
+}
+
+TEST(StatsTest, ListMovePush)
+{
+	bmstu::list<std::string> l;
+	std::string value(64, 'x');
+	bmstu::stats before = bmstu::stats::snapshot();
+	l.push_back(std::move(value));
+	l.push_back(l.front());
+	bmstu::container_stats s =
+		(bmstu::stats::snapshot() - before)[container_kind::list];
+	ASSERT_EQ(s.element_moves, 1u);
+	ASSERT_EQ(s.element_copies, 1u);
+}
+
+TEST(StatsTest, StringCopies)
+{
+	bmstu::string original("hello");
+	bmstu::stats before = bmstu::stats::snapshot();
+	bmstu::string copy(original);
+	bmstu::string moved(std::move(copy));
+	moved += original;
+	bmstu::container_stats s =
+		(bmstu::stats::snapshot() - before)[container_kind::string];
+	ASSERT_EQ(s.copies, 1u);
+	ASSERT_EQ(s.allocations, 2u);
+	ASSERT_EQ(s.reallocations, 1u);
+	ASSERT_EQ(s.element_copies, 10u);
+	ASSERT_EQ(s.element_moves, 5u);
+}
+
+TEST(StatsTest, ResetAndPrint)
+{
+	bmstu::simple_vector<int> v(3);
+	ASSERT_FALSE(bmstu::stats::snapshot().empty());
+	bmstu::stats::reset();
+	ASSERT_TRUE(bmstu::stats::snapshot().empty());
+	v.push_back(1);
+	std::ostringstream os;
+	os << bmstu::stats::snapshot();
+	ASSERT_NE(os.str().find("simple_vector: allocations=1 bytes=24 "
+							"reallocations=1"),
+			  std::string::npos);
+}
@@ -1,105 +1,479 @@
 #pragma once
 
+#include <algorithm>
 #include <exception>
+#if __has_include(<format>)
+#include <format>
+#endif
 #include <iostream>
+#include <memory>
+#include <memory_resource>
+#include <stdexcept>
+#include <type_traits>
+#include "bmstu_hash.h"
+#include "bmstu_stats.h"
 
 namespace bmstu
 {
-template <typename T>
-class basic_string;
-
-typedef basic_string<char> string;
-typedef basic_string<wchar_t> wstring;
-typedef basic_string<char16_t> u16string;
-typedef basic_string<char32_t> u32string;
-
-template <typename T>
+template <typename T, typename Alloc = std::allocator<T>>
 class basic_string;
 
 typedef basic_string<char> string;
 typedef basic_string<wchar_t> wstring;
-// typedef basic_string<char8_t> u8string;
+typedef basic_string<char8_t> u8string;
 typedef basic_string<char16_t> u16string;
 typedef basic_string<char32_t> u32string;
 
-template <typename T>
+template <typename T, typename Alloc>
 #ifdef _MSC_VER
 class basic_string
 #else
 class basic_string
 #endif
 {
+	using alloc_traits = std::allocator_traits<Alloc>;
+
    public:
+	using allocator_type = Alloc;
+
 	/// Конструктор по умолчанию
-	basic_string() : ptr_(new T[1]{0}), size_(0) {}
+	basic_string() noexcept(noexcept(Alloc()))
+		: ptr_(empty_()), size_(0), capacity_(0)
+	{
+	}
+
+	/// Пустая строка, память под которую выделяет alloc
+	explicit basic_string(const Alloc& alloc) noexcept
+		: alloc_(alloc), ptr_(empty_()), size_(0), capacity_(0)
+	{
+	}
 
-	basic_string(size_t size) : ptr_(new T[size + 1]), size_(size) {}
+	basic_string(size_t size, const Alloc& alloc = Alloc())
+		: basic_string(alloc)
+	{
+		reserve(size);
+		std::fill(ptr_, ptr_ + size, static_cast<T>(' '));
+		truncate_(size);
+	}
 
-	basic_string(std::initializer_list<T> il)
-		: ptr_(new T[il.size() + 1]), size_(il.size())
+	basic_string(std::initializer_list<T> il, const Alloc& alloc = Alloc())
+		: basic_string(alloc)
 	{
+		append_(il.begin(), il.size());
 	}
 
 	/// Конструктор с параметром си-с
-	basic_string(const T* c_str) {}
+	basic_string(const T* c_str, const Alloc& alloc = Alloc())
+		: basic_string(alloc)
+	{
+		append_(c_str, strlen_(c_str));
+	}
 
 	/// Конструктор копирования
-	basic_string(const basic_string& other) {}
+	basic_string(const basic_string& other)
+		: basic_string(
+			  alloc_traits::select_on_container_copy_construction(other.alloc_))
+	{
+		stats_hook::copy(stats_kind_);
+		append_(other.ptr_, other.size_);
+	}
 
 	/// Перемещающий конструктор
-	basic_string(basic_string&& dying) {}
+	basic_string(basic_string&& dying) noexcept
+		: alloc_(std::move(dying.alloc_)),
+		  ptr_(dying.ptr_),
+		  size_(dying.size_),
+		  capacity_(dying.capacity_)
+	{
+		dying.ptr_ = empty_();
+		dying.size_ = 0;
+		dying.capacity_ = 0;
+	}
 
 	/// Деструктор
-	~basic_string() {}
+	~basic_string() { clean_(); }
 
 	/// Геттер на си-строку
 	const T* c_str() const { return ptr_; }
 
-	size_t size() const { return 0; }
+	size_t size() const { return size_; }
+
+	size_t capacity() const { return capacity_; }
+
+	allocator_type get_allocator() const noexcept { return alloc_; }
+
+	/// Резервирует место под new_cap символов без изменения размера
+	void reserve(size_t new_cap)
+	{
+		if (new_cap > capacity_)
+		{
+			reallocate_(new_cap);
+		}
+	}
+
+	/// Дает op заполнить до count символов без предварительной инициализации,
+	/// op(ptr, count) возвращает итоговый размер
+	template <typename Operation>
+	void resize_and_overwrite(size_t count, Operation op)
+	{
+		reserve(count);
+		truncate_(static_cast<size_t>(op(ptr_, count)));
+	}
 
 	/// Оператор копирующего присваивания
-	basic_string& operator=(basic_string&& other) { return *this; }
+	basic_string& operator=(basic_string&& other)
+	{
+		if (this != &other)
+		{
+			if (!alloc_traits::propagate_on_container_move_assignment::value &&
+				alloc_ != other.alloc_)
+			{
+				return *this = other;
+			}
+			clean_();
+			if constexpr (alloc_traits::propagate_on_container_move_assignment::
+							  value)
+			{
+				alloc_ = std::move(other.alloc_);
+			}
+			ptr_ = other.ptr_;
+			size_ = other.size_;
+			capacity_ = other.capacity_;
+			other.ptr_ = empty_();
+			other.size_ = 0;
+			other.capacity_ = 0;
+		}
+		return *this;
+	}
 
 	/// Оператор копирующего присваивания си строки
-	basic_string& operator=(const T* c_str) { return *this; }
+	basic_string& operator=(const T* c_str)
+	{
+		truncate_();
+		append_(c_str, strlen_(c_str));
+		return *this;
+	}
 
 	/// Оператор копирующего присваивания
-	basic_string& operator=(const basic_string& other) { return *this; }
+	basic_string& operator=(const basic_string& other)
+	{
+		if (this != &other)
+		{
+			stats_hook::copy(stats_kind_);
+			truncate_();
+			append_(other.ptr_, other.size_);
+		}
+		return *this;
+	}
 
-	friend basic_string<T> operator+(const basic_string<T>& left,
-									 const basic_string<T>& right)
+	friend basic_string operator+(const basic_string& left,
+								  const basic_string& right)
 	{
-		return {};
+		basic_string result(
+			alloc_traits::select_on_container_copy_construction(left.alloc_));
+		result.reserve(left.size_ + right.size_);
+		result.append_(left.ptr_, left.size_);
+		result.append_(right.ptr_, right.size_);
+		return result;
+	}
+
+	friend bool operator==(const basic_string& left,
+						   const basic_string& right) noexcept
+	{
+		return left.size_ == right.size_ &&
+			   std::equal(left.ptr_, left.ptr_ + left.size_, right.ptr_);
 	}
 
 	template <typename S>
+		requires std::is_base_of_v<std::ios_base, S>
 	friend S& operator<<(S& os, const basic_string& obj)
 	{
+		using char_type = typename S::char_type;
+		if constexpr (std::is_same_v<char_type, T>)
+		{
+			os.write(obj.ptr_, static_cast<std::streamsize>(obj.size_));
+		}
+		else
+		{
+			// Символы другого типа переводятся кусками в буфер на стеке
+			char_type chunk[print_chunk_];
+			for (size_t done = 0; done < obj.size_; done += print_chunk_)
+			{
+				size_t count = std::min(print_chunk_, obj.size_ - done);
+				std::transform(obj.ptr_ + done, obj.ptr_ + done + count, chunk,
+							   [](T symbol)
+							   { return static_cast<char_type>(symbol); });
+				os.write(chunk, static_cast<std::streamsize>(count));
+			}
+		}
 		return os;
 	}
 
+	/// Читает поток до конца блоками через rdbuf()->sgetn
 	template <typename S>
+		requires std::is_base_of_v<std::ios_base, S>
 	friend S& operator>>(S& is, basic_string& obj)
 	{
+		typename std::basic_istream<typename S::char_type,
+									typename S::traits_type>::sentry
+			sentry(is, true);
+		obj.truncate_();
+		if (!sentry)
+		{
+			return is;
+		}
+		using char_type = typename S::char_type;
+		auto* buf = is.rdbuf();
+		while (true)
+		{
+			std::streamsize avail = buf->in_avail();
+			if (avail < 0)
+			{
+				break;
+			}
+			size_t want = std::max<size_t>(static_cast<size_t>(avail),
+										   read_chunk_);
+			std::streamsize got = 0;
+			if constexpr (std::is_same_v<char_type, T>)
+			{
+				if (obj.size_ + want > obj.capacity_)
+				{
+					obj.reserve(obj.grown_capacity_(obj.size_ + want));
+				}
+				got = buf->sgetn(obj.ptr_ + obj.size_,
+								 static_cast<std::streamsize>(want));
+				obj.size_ += static_cast<size_t>(got);
+			}
+			else
+			{
+				// Блок другого типа символов не больше read_chunk_
+				want = read_chunk_;
+				char_type chunk[read_chunk_];
+				got = buf->sgetn(chunk, read_chunk_);
+				if (obj.size_ + static_cast<size_t>(got) > obj.capacity_)
+				{
+					obj.reserve(obj.grown_capacity_(obj.size_ +
+													static_cast<size_t>(got)));
+				}
+				for (std::streamsize i = 0; i < got; ++i)
+				{
+					obj.ptr_[obj.size_++] = static_cast<T>(chunk[i]);
+				}
+			}
+			if (got < static_cast<std::streamsize>(want))
+			{
+				break;
+			}
+		}
+		obj.truncate_(obj.size_);
+		is.setstate(obj.size_ == 0 ? std::ios_base::eofbit |
+										 std::ios_base::failbit
+								   : std::ios_base::eofbit);
+		return is;
+	}
+
+	/// Читает строку до разделителя delim (разделитель извлекается, но не
+	/// сохраняется)
+	template <typename S>
+		requires std::is_base_of_v<std::ios_base, S>
+	friend S& getline(S& is, basic_string& obj, T delim = T('\n'))
+	{
+		typename std::basic_istream<typename S::char_type,
+									typename S::traits_type>::sentry
+			sentry(is, true);
+		obj.truncate_();
+		if (!sentry)
+		{
+			return is;
+		}
+		using traits = typename S::traits_type;
+		auto* buf = is.rdbuf();
+		T chunk[read_chunk_];
+		size_t filled = 0;
+		bool extracted = false;
+		std::ios_base::iostate state = std::ios_base::goodbit;
+		while (true)
+		{
+			auto c = buf->sbumpc();
+			if (traits::eq_int_type(c, traits::eof()))
+			{
+				state |= std::ios_base::eofbit;
+				break;
+			}
+			extracted = true;
+			T symbol = static_cast<T>(traits::to_char_type(c));
+			if (symbol == delim)
+			{
+				break;
+			}
+			chunk[filled++] = symbol;
+			if (filled == read_chunk_)
+			{
+				obj.append_(chunk, filled);
+				filled = 0;
+			}
+		}
+		obj.append_(chunk, filled);
+		if (!extracted)
+		{
+			state |= std::ios_base::failbit;
+		}
+		is.setstate(state);
 		return is;
 	}
 
-	basic_string& operator+=(const basic_string& other) { return *this; }
+	basic_string& operator+=(const basic_string& other)
+	{
+		append_(other.ptr_, other.size_);
+		return *this;
+	}
 
-	basic_string& operator+=(T symbol) { return *this; }
+	basic_string& operator+=(T symbol)
+	{
+		append_(&symbol, 1);
+		return *this;
+	}
 
 	T& operator[](size_t index) noexcept { return *(ptr_ + index); }
 
-	T& at(size_t index) { throw std::out_of_range("Wrong index"); }
+	T& at(size_t index)
+	{
+		if (index >= size_)
+		{
+			throw std::out_of_range("Wrong index");
+		}
+		return ptr_[index];
+	}
 
 	T* data() { return ptr_; }
 
    private:
-	static size_t strlen_(const T* str) { return 0; }
+	/// Размер блока, которым читается поток
+	static constexpr size_t read_chunk_ = 4096;
+	/// Размер блока, которым печатаются символы другого типа
+	static constexpr size_t print_chunk_ = 256;
+
+	static size_t strlen_(const T* str)
+	{
+		size_t len = 0;
+		while (str[len] != 0)
+		{
+			++len;
+		}
+		return len;
+	}
+
+	/// Общий терминатор для пустых строк, чтобы не аллоцировать
+	static T* empty_() noexcept
+	{
+		static T zero = 0;
+		return &zero;
+	}
+
+	/// Емкость с геометрическим ростом, не меньше required
+	size_t grown_capacity_(size_t required) const noexcept
+	{
+		return std::max(required, capacity_ * 2);
+	}
+
+	static constexpr container_kind stats_kind_ = container_kind::string;
+
+	void reallocate_(size_t new_cap)
+	{
+		T* fresh = alloc_traits::allocate(alloc_, new_cap + 1);
+		stats_hook::allocation(stats_kind_, (new_cap + 1) * sizeof(T));
+		if (capacity_ != 0)
+		{
+			stats_hook::reallocation(stats_kind_);
+			stats_hook::element_moves(stats_kind_, size_);
+		}
+		std::copy(ptr_, ptr_ + size_, fresh);
+		fresh[size_] = 0;
+		clean_();
+		ptr_ = fresh;
+		capacity_ = new_cap;
+	}
 
-	void clean_() {}
+	void append_(const T* str, size_t len)
+	{
+		if (len == 0)
+		{
+			return;
+		}
+		if (size_ + len > capacity_)
+		{
+			reallocate_(grown_capacity_(size_ + len));
+		}
+		std::copy(str, str + len, ptr_ + size_);
+		stats_hook::element_copies(stats_kind_, len);
+		size_ += len;
+		ptr_[size_] = 0;
+	}
 
+	/// Обрезает строку до new_size, не трогая общий терминатор
+	void truncate_(size_t new_size = 0) noexcept
+	{
+		size_ = new_size;
+		if (capacity_ != 0)
+		{
+			ptr_[size_] = 0;
+		}
+	}
+
+	void clean_()
+	{
+		if (ptr_ != empty_())
+		{
+			alloc_traits::deallocate(alloc_, ptr_, capacity_ + 1);
+		}
+		ptr_ = empty_();
+		capacity_ = 0;
+	}
+
+	[[no_unique_address]] Alloc alloc_;
 	T* ptr_ = nullptr;
 	size_t size_;
+	size_t capacity_;
 };
+
+/// Строки, память под которые выделяет std::pmr::memory_resource, например
+/// std::pmr::monotonic_buffer_resource: все строки запроса освобождаются
+/// одним release() ресурса
+namespace pmr
+{
+template <typename T>
+using basic_string =
+	bmstu::basic_string<T, std::pmr::polymorphic_allocator<T>>;
+
+typedef basic_string<char> string;
+typedef basic_string<wchar_t> wstring;
+typedef basic_string<char8_t> u8string;
+typedef basic_string<char16_t> u16string;
+typedef basic_string<char32_t> u32string;
+}  // namespace pmr
 }  // namespace bmstu
+
+template <typename T, typename Alloc>
+struct std::hash<bmstu::basic_string<T, Alloc>>
+{
+	size_t operator()(const bmstu::basic_string<T, Alloc>& str) const noexcept
+	{
+		return bmstu::hash_bytes(str.c_str(), str.size() * sizeof(T));
+	}
+};
+
+#if defined(__cpp_lib_format)
+/// Строка форматируется как string_view: ширина, выравнивание, точность
+template <typename T, typename Alloc>
+struct std::formatter<bmstu::basic_string<T, Alloc>, T>
+	: std::formatter<std::basic_string_view<T>, T>
+{
+	template <typename FormatContext>
+	typename FormatContext::iterator format(
+		const bmstu::basic_string<T, Alloc>& str, FormatContext& ctx) const
+	{
+		return std::formatter<std::basic_string_view<T>, T>::format(
+			std::basic_string_view<T>(str.c_str(), str.size()), ctx);
+	}
+};
+#endif
@@ -2,6 +2,8 @@
 #include "bmstu_string.h"
 
 #include <sstream>
+#include <unordered_set>
+#include "alloc_tracker.h"
 #include "bmstu_string.h"
 
 TEST(StringTest, DefaultConstructor)
@@ -289,3 +291,198 @@ TEST(StringTest, Item)
 	ASSERT_EQ(a_str[1], L'Т');
 	ASSERT_EQ(a_str[a_str.size() - 1], L'Г');
 }
+
+TEST(StringTest, IStreamLarge)
+{
+	std::string source;
+	for (size_t i = 0; i < 100000; ++i)
+	{
+		source += static_cast<char>('a' + i % 26);
+	}
+	std::stringstream ss(source);
+	bmstu::string a_str;
+	ss >> a_str;
+	ASSERT_EQ(a_str.size(), source.size());
+	ASSERT_STREQ(a_str.c_str(), source.c_str());
+	ASSERT_TRUE(ss.eof());
+}
+
+namespace
+{
+/// Поток без позиционирования и без оценки остатка: in_avail отдает только
+/// содержимое маленького буфера
+class trickle_buf : public std::streambuf
+{
+   public:
+	explicit trickle_buf(size_t size) : left_(size) {}
+
+   protected:
+	int_type underflow() override
+	{
+		if (left_ == 0)
+		{
+			return traits_type::eof();
+		}
+		size_t n = std::min(left_, sizeof(buffer_));
+		std::fill_n(buffer_, n, 'z');
+		left_ -= n;
+		setg(buffer_, buffer_, buffer_ + n);
+		return traits_type::to_int_type(buffer_[0]);
+	}
+
+   private:
+	char buffer_[16];
+	size_t left_;
+};
+}  // namespace
+
+TEST(StringTest, IStreamUnbufferedCapacity)
+{
+	for (size_t size : {50000, 100000})
+	{
+		trickle_buf buf(size);
+		std::istream is(&buf);
+		bmstu::string a_str;
+		is >> a_str;
+		ASSERT_EQ(a_str.size(), size);
+		// Емкость растет вдвое от нужной, а не на каждом блоке
+		ASSERT_LE(a_str.capacity(), 2 * size);
+	}
+}
+
+TEST(StringTest, IStreamWideIntoNarrow)
+{
+	std::wstringstream ss(std::wstring(10000, L'w'));
+	bmstu::string a_str;
+	ss >> a_str;
+	ASSERT_EQ(a_str.size(), 10000);
+	ASSERT_EQ(a_str[9999], 'w');
+	ASSERT_TRUE(ss.eof());
+}
+
+TEST(StringTest, IStreamEmpty)
+{
+	std::stringstream ss;
+	bmstu::string a_str("old");
+	ss >> a_str;
+	ASSERT_STREQ(a_str.c_str(), "");
+	ASSERT_EQ(a_str.size(), 0);
+	ASSERT_TRUE(ss.fail());
+}
+
+TEST(StringTest, IStreamU16)
+{
+	std::stringstream ss("Value of\nstring");
+	bmstu::u16string a_str;
+	ss >> a_str;
+	ASSERT_EQ(a_str.size(), 15);
+	ASSERT_EQ(a_str[9], u's');
+}
+
+TEST(StringTest, GetLine)
+{
+	std::stringstream ss("first\nsecond\n\nlast");
+	bmstu::string line;
+	ASSERT_TRUE(getline(ss, line));
+	ASSERT_STREQ(line.c_str(), "first");
+	ASSERT_TRUE(getline(ss, line));
+	ASSERT_STREQ(line.c_str(), "second");
+	ASSERT_TRUE(getline(ss, line));
+	ASSERT_STREQ(line.c_str(), "");
+	ASSERT_TRUE(getline(ss, line));
+	ASSERT_STREQ(line.c_str(), "last");
+	ASSERT_FALSE(getline(ss, line));
+}
+
+TEST(StringTest, GetLineDelimiterW)
+{
+	std::wstringstream ss(L"один;два;три");
+	bmstu::wstring item;
+	getline(ss, item, L';');
+	ASSERT_STREQ(item.c_str(), L"один");
+	getline(ss, item, L';');
+	ASSERT_STREQ(item.c_str(), L"два");
+	getline(ss, item, L';');
+	ASSERT_STREQ(item.c_str(), L"три");
+	ASSERT_TRUE(ss.eof());
+}
+
+TEST(StringTest, GetLineLong)
+{
+	std::string source(10000, 'x');
+	std::stringstream ss(source + "\ntail");
+	bmstu::string line;
+	getline(ss, line);
+	ASSERT_EQ(line.size(), source.size());
+	getline(ss, line);
+	ASSERT_STREQ(line.c_str(), "tail");
+}
+
+TEST(StringTest, Hash)
+{
+	std::unordered_set<bmstu::string> set;
+	set.insert(bmstu::string("first"));
+	set.insert(bmstu::string("second"));
+	set.insert(bmstu::string("first"));
+	ASSERT_EQ(set.size(), 2);
+	ASSERT_EQ(std::hash<bmstu::u32string>{}(bmstu::u32string(U"ключ")),
+			  std::hash<bmstu::u32string>{}(bmstu::u32string(U"ключ")));
+	ASSERT_NE(std::hash<bmstu::wstring>{}(bmstu::wstring(L"ключ")),
+			  std::hash<bmstu::wstring>{}(bmstu::wstring(L"ключи")));
+}
+
+TEST(StringTest, ResizeAndOverwrite)
+{
+	bmstu::string str("abc");
+	str.resize_and_overwrite(10,
+							 [](char* buf, size_t count)
+							 {
+								 buf[3] = 'd';
+								 buf[4] = 'e';
+								 return count - 5;
+							 });
+	ASSERT_STREQ(str.c_str(), "abcde");
+	ASSERT_EQ(str.size(), 5);
+	ASSERT_GE(str.capacity(), 10);
+}
+
+TEST(StringTest, AllocationBudget)
+{
+	bmstu::string str("allocation budget");
+	EXPECT_ALLOCS(0, bmstu::string moved(std::move(str)));
+	EXPECT_ALLOCS(0, bmstu::string empty);
+	bmstu::string copy;
+	EXPECT_ALLOCS(1, copy = bmstu::string("x"));
+	bmstu::string reserved;
+	EXPECT_ALLOCS(1, {
+		reserved.reserve(100);
+		for (int i = 0; i < 100; ++i)
+		{
+			reserved += 'a';
+		}
+	});
+}
+
+TEST(StringTest, PrintOtherCharType)
+{
+	bmstu::u16string wide;
+	for (int i = 0; i < 1000; ++i)
+	{
+		wide += static_cast<char16_t>('a' + i % 26);
+	}
+	std::ostringstream os;
+	os << wide;
+	ASSERT_EQ(os.str().size(), 1000u);
+	ASSERT_EQ(os.str().substr(0, 4), "abcd");
+	ASSERT_EQ(os.str()[999], 'a' + 999 % 26);
+}
+
+#if defined(__cpp_lib_format)
+TEST(StringTest, Format)
+{
+	bmstu::string str("bmstu");
+	ASSERT_EQ(std::format("[{}]", str), "[bmstu]");
+	ASSERT_EQ(std::format("[{:>7}]", str), "[  bmstu]");
+	ASSERT_EQ(std::format("[{:.3}]", str), "[bms]");
+}
+#endif
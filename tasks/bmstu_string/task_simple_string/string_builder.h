@@ -0,0 +1,193 @@
+#pragma once
+
+#include <algorithm>
+#include <charconv>
+#include <concepts>
+#include <cstddef>
+#include <memory_resource>
+#include <string_view>
+#include <type_traits>
+#include "bmstu_string.h"
+
+namespace bmstu
+{
+/// Собирает строку из фрагментов в цепочке блоков и отдает ее одной
+/// аллокацией в str(). Блоки берутся из memory_resource, так что builder
+/// можно поставить поверх арены запроса
+template <typename T>
+class string_builder
+{
+   public:
+	explicit string_builder(
+		std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+		: resource_(resource)
+	{
+	}
+
+	string_builder(const string_builder&) = delete;
+	string_builder& operator=(const string_builder&) = delete;
+
+	~string_builder() { release_(); }
+
+	string_builder& append(const T* str, size_t len)
+	{
+		while (len != 0)
+		{
+			if (tail_ == nullptr || tail_->used == tail_->capacity)
+			{
+				add_chunk_(len);
+			}
+			size_t part = std::min(len, tail_->capacity - tail_->used);
+			std::copy(str, str + part, tail_->data() + tail_->used);
+			tail_->used += part;
+			size_ += part;
+			str += part;
+			len -= part;
+		}
+		return *this;
+	}
+
+	string_builder& append(const T* c_str)
+	{
+		return append(c_str, std::char_traits<T>::length(c_str));
+	}
+
+	string_builder& append(std::basic_string_view<T> view)
+	{
+		return append(view.data(), view.size());
+	}
+
+	template <typename Alloc>
+	string_builder& append(const basic_string<T, Alloc>& str)
+	{
+		return append(str.c_str(), str.size());
+	}
+
+	string_builder& append(T symbol) { return append(&symbol, 1); }
+
+	/// Десятичная запись целого числа. char - символ, а не число, и для
+	/// строк других типов тоже добавляется как символ. std::to_chars, а не
+	/// int64_2str_r: заголовок не тянет за собой int2str.c, а по
+	/// int2str_bench разница внутри builder около 3%
+	template <std::integral I>
+		requires(!std::is_same_v<I, T> && !std::is_same_v<I, bool> &&
+				 !std::is_same_v<I, char>)
+	string_builder& append(I number)
+	{
+		char digits[24];
+		auto [end, ec] = std::to_chars(digits, digits + sizeof(digits), number);
+		size_t len = static_cast<size_t>(end - digits);
+		if constexpr (std::is_same_v<T, char>)
+		{
+			return append(digits, len);
+		}
+		else
+		{
+			T wide[24];
+			std::copy(digits, end, wide);
+			return append(wide, len);
+		}
+	}
+
+	template <typename V>
+	string_builder& operator<<(const V& value)
+	{
+		return append(value);
+	}
+
+	/// Суммарная длина накопленных фрагментов
+	size_t size() const noexcept { return size_; }
+
+	/// Сбрасывает содержимое, оставляя первый блок для повторного использования
+	void clear() noexcept
+	{
+		if (head_ != nullptr)
+		{
+			chunk* rest = head_->next;
+			head_->next = nullptr;
+			head_->used = 0;
+			tail_ = head_;
+			free_chain_(rest);
+		}
+		size_ = 0;
+	}
+
+	basic_string<T> str() const { return str(std::allocator<T>()); }
+
+	/// Итоговая строка, память под которую выделяет alloc
+	template <typename Alloc>
+	basic_string<T, Alloc> str(const Alloc& alloc) const
+	{
+		basic_string<T, Alloc> result(alloc);
+		result.resize_and_overwrite(size_,
+									[this](T* dst, size_t count)
+									{
+										for (chunk* c = head_; c != nullptr;
+											 c = c->next)
+										{
+											std::copy(c->data(),
+													  c->data() + c->used, dst);
+											dst += c->used;
+										}
+										return count;
+									});
+		return result;
+	}
+
+   private:
+	struct chunk
+	{
+		chunk* next;
+		size_t capacity;
+		size_t used;
+
+		T* data() noexcept { return reinterpret_cast<T*>(this + 1); }
+	};
+
+	static constexpr size_t first_chunk_ = 256;
+
+	static size_t chunk_bytes_(size_t capacity) noexcept
+	{
+		return sizeof(chunk) + capacity * sizeof(T);
+	}
+
+	void add_chunk_(size_t required)
+	{
+		size_t capacity =
+			std::max(required, tail_ ? tail_->capacity * 2 : first_chunk_);
+		void* raw = resource_->allocate(chunk_bytes_(capacity), alignof(chunk));
+		chunk* fresh = new (raw) chunk{nullptr, capacity, 0};
+		if (tail_ != nullptr)
+		{
+			tail_->next = fresh;
+		}
+		else
+		{
+			head_ = fresh;
+		}
+		tail_ = fresh;
+	}
+
+	void free_chain_(chunk* c) noexcept
+	{
+		while (c != nullptr)
+		{
+			chunk* next = c->next;
+			resource_->deallocate(c, chunk_bytes_(c->capacity), alignof(chunk));
+			c = next;
+		}
+	}
+
+	void release_() noexcept
+	{
+		free_chain_(head_);
+		head_ = tail_ = nullptr;
+		size_ = 0;
+	}
+
+	std::pmr::memory_resource* resource_;
+	chunk* head_ = nullptr;
+	chunk* tail_ = nullptr;
+	size_t size_ = 0;
+};
+}  // namespace bmstu
@@ -0,0 +1,103 @@
+#include <gtest/gtest.h>
+
+#include <climits>
+#include <memory_resource>
+#include <string>
+#include "string_builder.h"
+
+TEST(StringBuilderTest, AppendFragments)
+{
+	bmstu::string_builder<char> builder;
+	bmstu::string name("world");
+	builder << "Hello, " << name << '!' << std::string_view(" view");
+	ASSERT_EQ(builder.size(), 18);
+	ASSERT_STREQ(builder.str().c_str(), "Hello, world! view");
+}
+
+TEST(StringBuilderTest, Empty)
+{
+	bmstu::string_builder<wchar_t> builder;
+	auto str = builder.str();
+	ASSERT_EQ(str.size(), 0);
+	ASSERT_STREQ(str.c_str(), L"");
+}
+
+TEST(StringBuilderTest, Integers)
+{
+	bmstu::string_builder<char> builder;
+	builder << 0 << ' ' << -42 << ' ' << INT_MIN << ' ' << ULLONG_MAX << ' '
+			<< static_cast<short>(7);
+	ASSERT_STREQ(builder.str().c_str(),
+				 "0 -42 -2147483648 18446744073709551615 7");
+}
+
+TEST(StringBuilderTest, WideIntegers)
+{
+	bmstu::string_builder<char16_t> builder;
+	builder << u"id=" << 12345L << ',' << 'x';
+	auto str = builder.str();
+	ASSERT_EQ(std::u16string(str.c_str()), u"id=12345,x");
+}
+
+TEST(StringBuilderTest, SpansManyChunks)
+{
+	bmstu::string_builder<char> builder;
+	std::string expected;
+	for (int i = 0; i < 5000; ++i)
+	{
+		builder << "item" << i << ';';
+		expected += "item" + std::to_string(i) + ';';
+	}
+	std::string big(3000, 'x');
+	builder.append(big.c_str(), big.size());
+	expected += big;
+	ASSERT_EQ(builder.size(), expected.size());
+	ASSERT_STREQ(builder.str().c_str(), expected.c_str());
+}
+
+TEST(StringBuilderTest, ClearReuses)
+{
+	bmstu::string_builder<char> builder;
+	builder << "first" << 1;
+	builder.clear();
+	ASSERT_EQ(builder.size(), 0);
+	builder << "second" << 2;
+	ASSERT_STREQ(builder.str().c_str(), "second2");
+}
+
+TEST(StringBuilderTest, ArenaBacked)
+{
+	std::pmr::monotonic_buffer_resource arena;
+	bmstu::string_builder<char> builder(&arena);
+	builder << "response " << 200;
+	bmstu::pmr::string str =
+		builder.str(std::pmr::polymorphic_allocator<char>(&arena));
+	ASSERT_STREQ(str.c_str(), "response 200");
+	ASSERT_EQ(str.get_allocator().resource(), &arena);
+}
+
+TEST(PmrStringTest, UsesArena)
+{
+	char buffer[1024];
+	std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer),
+											  std::pmr::null_memory_resource());
+	std::pmr::polymorphic_allocator<char> alloc(&arena);
+	bmstu::pmr::string a("per-request", alloc);
+	bmstu::pmr::string b(" string", alloc);
+	a += b;
+	a += b;
+	ASSERT_STREQ(a.c_str(), "per-request string string");
+	ASSERT_GE(a.c_str(), buffer);
+	ASSERT_LT(a.c_str(), buffer + sizeof(buffer));
+}
+
+TEST(PmrStringTest, MoveAcrossResourcesCopies)
+{
+	std::pmr::monotonic_buffer_resource first;
+	std::pmr::monotonic_buffer_resource second;
+	bmstu::pmr::string a("content", &first);
+	bmstu::pmr::string b(&second);
+	b = std::move(a);
+	ASSERT_STREQ(b.c_str(), "content");
+	ASSERT_EQ(b.get_allocator().resource(), &second);
+}
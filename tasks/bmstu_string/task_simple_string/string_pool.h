@@ -0,0 +1,254 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string_view>
+#include <vector>
+#include "bmstu_string.h"
+
+namespace bmstu
+{
+template <typename T>
+class basic_string_pool;
+
+/// Компактный дескриптор строки из пула: сравнение по указателю, хеш
+/// посчитан при интернировании
+template <typename T>
+class interned_string
+{
+	struct entry
+	{
+		size_t hash;
+		size_t size;
+
+		const T* chars() const noexcept
+		{
+			return reinterpret_cast<const T*>(this + 1);
+		}
+	};
+
+	friend class basic_string_pool<T>;
+
+   public:
+	interned_string() noexcept = default;
+
+	const T* c_str() const noexcept
+	{
+		static const T zero = 0;
+		return entry_ ? entry_->chars() : &zero;
+	}
+
+	size_t size() const noexcept { return entry_ ? entry_->size : 0; }
+
+	bool empty() const noexcept { return entry_ == nullptr; }
+
+	size_t hash() const noexcept
+	{
+		return entry_ ? entry_->hash : hash_bytes(nullptr, 0);
+	}
+
+	std::basic_string_view<T> view() const noexcept
+	{
+		return {c_str(), size()};
+	}
+
+	/// Копия всех size() символов, включая встроенные нули
+	basic_string<T> str() const
+	{
+		basic_string<T> result(size());
+		std::copy_n(c_str(), size(), &result[0]);
+		return result;
+	}
+
+	friend bool operator==(const interned_string& lhs,
+						   const interned_string& rhs) noexcept
+	{
+		return lhs.entry_ == rhs.entry_;
+	}
+
+	friend bool operator!=(const interned_string& lhs,
+						   const interned_string& rhs) noexcept
+	{
+		return lhs.entry_ != rhs.entry_;
+	}
+
+   private:
+	explicit interned_string(const entry* e) noexcept : entry_(e) {}
+
+	const entry* entry_ = nullptr;
+};
+
+/// Потокобезопасный пул интернированных строк. Содержимое хранится в арене
+/// пула, дескрипторы действительны, пока жив пул
+template <typename T>
+class basic_string_pool
+{
+	using entry = typename interned_string<T>::entry;
+
+   public:
+	basic_string_pool() = default;
+	basic_string_pool(const basic_string_pool&) = delete;
+	basic_string_pool& operator=(const basic_string_pool&) = delete;
+
+	interned_string<T> intern(const T* str, size_t len)
+	{
+		if (len == 0)
+		{
+			return {};
+		}
+		size_t hash = hash_bytes(str, len * sizeof(T));
+		shard& sh = shards_[(hash >> 7) % shard_count_];
+		{
+			std::shared_lock lock(sh.mutex);
+			if (const entry* found = sh.find(hash, str, len))
+			{
+				return interned_string<T>(found);
+			}
+		}
+		std::unique_lock lock(sh.mutex);
+		if (const entry* found = sh.find(hash, str, len))
+		{
+			return interned_string<T>(found);
+		}
+		return interned_string<T>(sh.insert(hash, str, len));
+	}
+
+	interned_string<T> intern(const T* c_str)
+	{
+		return intern(c_str, std::char_traits<T>::length(c_str));
+	}
+
+	interned_string<T> intern(const basic_string<T>& str)
+	{
+		return intern(str.c_str(), str.size());
+	}
+
+	/// Количество уникальных строк в пуле
+	size_t size() const
+	{
+		size_t total = 0;
+		for (const shard& sh : shards_)
+		{
+			std::shared_lock lock(sh.mutex);
+			total += sh.count;
+		}
+		return total;
+	}
+
+   private:
+	static constexpr size_t shard_count_ = 16;
+	static constexpr size_t block_size_ = 16 * 1024;
+
+	/// Часть пула со своей блокировкой, таблицей и ареной
+	struct shard
+	{
+		const entry* find(size_t hash, const T* str, size_t len) const
+		{
+			if (table.empty())
+			{
+				return nullptr;
+			}
+			size_t mask = table.size() - 1;
+			for (size_t i = hash & mask; table[i] != nullptr;
+				 i = (i + 1) & mask)
+			{
+				const entry* e = table[i];
+				if (e->hash == hash && e->size == len &&
+					std::char_traits<T>::compare(e->chars(), str, len) == 0)
+				{
+					return e;
+				}
+			}
+			return nullptr;
+		}
+
+		const entry* insert(size_t hash, const T* str, size_t len)
+		{
+			if ((count + 1) * 2 > table.size())
+			{
+				rehash(table.empty() ? 64 : table.size() * 2);
+			}
+			entry* e = allocate(sizeof(entry) + (len + 1) * sizeof(T));
+			e->hash = hash;
+			e->size = len;
+			T* chars = const_cast<T*>(e->chars());
+			std::char_traits<T>::copy(chars, str, len);
+			chars[len] = 0;
+			place(e);
+			++count;
+			return e;
+		}
+
+		void rehash(size_t new_size)
+		{
+			std::vector<const entry*> old(new_size, nullptr);
+			old.swap(table);
+			for (const entry* e : old)
+			{
+				if (e != nullptr)
+				{
+					place(e);
+				}
+			}
+		}
+
+		void place(const entry* e)
+		{
+			size_t mask = table.size() - 1;
+			size_t i = e->hash & mask;
+			while (table[i] != nullptr)
+			{
+				i = (i + 1) & mask;
+			}
+			table[i] = e;
+		}
+
+		entry* allocate(size_t bytes)
+		{
+			bytes = (bytes + alignof(entry) - 1) & ~(alignof(entry) - 1);
+			if (bytes > block_size_)
+			{
+				blocks.emplace_back(new std::byte[bytes]);
+				return reinterpret_cast<entry*>(blocks.back().get());
+			}
+			if (current == nullptr || used + bytes > block_size_)
+			{
+				blocks.emplace_back(new std::byte[block_size_]);
+				used = 0;
+				current = blocks.back().get();
+			}
+			std::byte* slot = current + used;
+			used += bytes;
+			return reinterpret_cast<entry*>(slot);
+		}
+
+		mutable std::shared_mutex mutex;
+		std::vector<const entry*> table;
+		std::vector<std::unique_ptr<std::byte[]>> blocks;
+		std::byte* current = nullptr;
+		size_t used = 0;
+		size_t count = 0;
+	};
+
+	std::array<shard, shard_count_> shards_;
+};
+
+typedef basic_string_pool<char> string_pool;
+typedef basic_string_pool<wchar_t> wstring_pool;
+typedef basic_string_pool<char16_t> u16string_pool;
+typedef basic_string_pool<char32_t> u32string_pool;
+}  // namespace bmstu
+
+template <typename T>
+struct std::hash<bmstu::interned_string<T>>
+{
+	size_t operator()(const bmstu::interned_string<T>& str) const noexcept
+	{
+		return str.hash();
+	}
+};
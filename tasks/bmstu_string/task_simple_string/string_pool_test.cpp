@@ -0,0 +1,124 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+#include "string_pool.h"
+
+TEST(StringPoolTest, SameContentSameHandle)
+{
+	bmstu::string_pool pool;
+	bmstu::string key("route/users");
+	auto a = pool.intern(key);
+	auto b = pool.intern("route/users");
+	ASSERT_EQ(a, b);
+	ASSERT_EQ(a.c_str(), b.c_str());
+	ASSERT_STREQ(a.c_str(), "route/users");
+	ASSERT_EQ(a.size(), 11);
+	ASSERT_EQ(pool.size(), 1);
+}
+
+TEST(StringPoolTest, DifferentContentDifferentHandle)
+{
+	bmstu::string_pool pool;
+	auto a = pool.intern("alpha");
+	auto b = pool.intern("alphb");
+	ASSERT_NE(a, b);
+	ASSERT_EQ(pool.size(), 2);
+}
+
+TEST(StringPoolTest, EmptyString)
+{
+	bmstu::string_pool pool;
+	bmstu::interned_string<char> empty;
+	ASSERT_EQ(pool.intern(""), empty);
+	ASSERT_STREQ(empty.c_str(), "");
+	ASSERT_EQ(empty.size(), 0);
+	ASSERT_EQ(pool.size(), 0);
+}
+
+TEST(StringPoolTest, WideAndLongStrings)
+{
+	bmstu::wstring_pool pool;
+	std::wstring big(100000, L'я');
+	auto a = pool.intern(big.c_str());
+	auto b = pool.intern(L"строка");
+	auto c = pool.intern(big.c_str());
+	ASSERT_EQ(a, c);
+	ASSERT_EQ(a.size(), big.size());
+	ASSERT_STREQ(b.c_str(), L"строка");
+	ASSERT_STREQ(b.str().c_str(), L"строка");
+}
+
+TEST(StringPoolTest, EmbeddedZero)
+{
+	bmstu::string_pool pool;
+	const char raw[] = {'a', '\0', 'b'};
+	auto a = pool.intern(raw, 3);
+	ASSERT_NE(a, pool.intern("a"));
+	ASSERT_EQ(a.view(), std::string_view(raw, 3));
+	bmstu::string copy = a.str();
+	ASSERT_EQ(copy.size(), 3u);
+	ASSERT_EQ(copy[1], '\0');
+	ASSERT_EQ(copy[2], 'b');
+	ASSERT_EQ(pool.intern(copy), a);
+}
+
+TEST(StringPoolTest, ManyKeysSurviveRehash)
+{
+	bmstu::string_pool pool;
+	std::vector<bmstu::interned_string<char>> handles;
+	for (int i = 0; i < 10000; ++i)
+	{
+		handles.push_back(pool.intern(std::to_string(i).c_str()));
+	}
+	ASSERT_EQ(pool.size(), 10000);
+	for (int i = 0; i < 10000; ++i)
+	{
+		ASSERT_EQ(pool.intern(std::to_string(i).c_str()), handles[i]);
+		ASSERT_STREQ(handles[i].c_str(), std::to_string(i).c_str());
+	}
+}
+
+TEST(StringPoolTest, HashIsPrecomputed)
+{
+	bmstu::string_pool pool;
+	auto a = pool.intern("key");
+	ASSERT_EQ(std::hash<bmstu::interned_string<char>>{}(a), a.hash());
+	ASSERT_EQ(a.hash(), std::hash<bmstu::string>{}(bmstu::string("key")));
+	std::unordered_set<bmstu::interned_string<char>> set{a, pool.intern("key")};
+	ASSERT_EQ(set.size(), 1);
+}
+
+TEST(StringPoolTest, ConcurrentIntern)
+{
+	bmstu::string_pool pool;
+	constexpr int threads_count = 8;
+	constexpr int keys_count = 2000;
+	std::vector<std::vector<bmstu::interned_string<char>>> results(
+		threads_count);
+	std::vector<std::thread> threads;
+	for (int t = 0; t < threads_count; ++t)
+	{
+		threads.emplace_back(
+			[&pool, &results, t]
+			{
+				for (int i = 0; i < keys_count; ++i)
+				{
+					results[t].push_back(
+						pool.intern(("key" + std::to_string(i)).c_str()));
+				}
+			});
+	}
+	for (auto& thread : threads)
+	{
+		thread.join();
+	}
+	ASSERT_EQ(pool.size(), keys_count);
+	for (int t = 1; t < threads_count; ++t)
+	{
+		ASSERT_EQ(results[t], results[0]);
+	}
+}
@@ -0,0 +1,425 @@
+#pragma once
+
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+#include "bmstu_string.h"
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define BMSTU_TRANSCODE_SSE2 1
+#endif
+
+namespace bmstu
+{
+namespace detail
+{
+/// Ширина кодовой единицы определяет кодировку: 1 - UTF-8, 2 - UTF-16,
+/// 4 - UTF-32 (wchar_t попадает в UTF-16 или UTF-32 по размеру)
+template <typename T>
+using utf_unit = std::make_unsigned_t<T>;
+
+[[noreturn]] inline void transcode_fail()
+{
+	throw std::invalid_argument("Invalid Unicode sequence");
+}
+
+/// Длина префикса из ASCII-символов, проверяется по 16 байт за раз
+template <typename T>
+size_t ascii_run(const T* p, size_t n) noexcept
+{
+	size_t i = 0;
+#ifdef BMSTU_TRANSCODE_SSE2
+	if constexpr (sizeof(T) == 1)
+	{
+		for (; i + 16 <= n; i += 16)
+		{
+			__m128i v =
+				_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+			unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(v));
+			if (mask != 0)
+			{
+				return i + static_cast<size_t>(std::countr_zero(mask));
+			}
+		}
+	}
+	else if constexpr (sizeof(T) == 2)
+	{
+		const __m128i high = _mm_set1_epi16(static_cast<short>(0xff80));
+		for (; i + 8 <= n; i += 8)
+		{
+			__m128i v =
+				_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+			__m128i ascii = _mm_cmpeq_epi16(_mm_and_si128(v, high),
+											_mm_setzero_si128());
+			unsigned mask =
+				~static_cast<unsigned>(_mm_movemask_epi8(ascii)) & 0xffffu;
+			if (mask != 0)
+			{
+				return i + static_cast<size_t>(std::countr_zero(mask)) / 2;
+			}
+		}
+	}
+	else
+	{
+		const __m128i high = _mm_set1_epi32(static_cast<int>(0xffffff80));
+		for (; i + 4 <= n; i += 4)
+		{
+			__m128i v =
+				_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+			__m128i ascii = _mm_cmpeq_epi32(_mm_and_si128(v, high),
+											_mm_setzero_si128());
+			unsigned mask =
+				~static_cast<unsigned>(_mm_movemask_epi8(ascii)) & 0xffffu;
+			if (mask != 0)
+			{
+				return i + static_cast<size_t>(std::countr_zero(mask)) / 4;
+			}
+		}
+	}
+#else
+	if constexpr (sizeof(T) == 1)
+	{
+		for (; i + 8 <= n; i += 8)
+		{
+			uint64_t v;
+			std::memcpy(&v, p + i, 8);
+			v &= 0x8080808080808080ull;
+			if (v != 0)
+			{
+				if constexpr (std::endian::native == std::endian::little)
+				{
+					return i + static_cast<size_t>(std::countr_zero(v)) / 8;
+				}
+				break;
+			}
+		}
+	}
+#endif
+	for (; i < n && static_cast<utf_unit<T>>(p[i]) < 0x80; ++i)
+	{
+	}
+	return i;
+}
+
+/// Копирует ASCII-участок с расширением или сужением кодовых единиц
+template <typename To, typename From>
+void copy_ascii(const From* src, To* dst, size_t n) noexcept
+{
+	size_t k = 0;
+	if constexpr (sizeof(To) == sizeof(From))
+	{
+		std::memcpy(dst, src, n * sizeof(To));
+		return;
+	}
+#ifdef BMSTU_TRANSCODE_SSE2
+	const __m128i zero = _mm_setzero_si128();
+	auto load = [](const void* p)
+	{ return _mm_loadu_si128(static_cast<const __m128i*>(p)); };
+	auto store = [](void* p, __m128i v)
+	{ _mm_storeu_si128(static_cast<__m128i*>(p), v); };
+	if constexpr (sizeof(From) == 1 && sizeof(To) == 2)
+	{
+		for (; k + 16 <= n; k += 16)
+		{
+			__m128i v = load(src + k);
+			store(dst + k, _mm_unpacklo_epi8(v, zero));
+			store(dst + k + 8, _mm_unpackhi_epi8(v, zero));
+		}
+	}
+	else if constexpr (sizeof(From) == 1 && sizeof(To) == 4)
+	{
+		for (; k + 16 <= n; k += 16)
+		{
+			__m128i v = load(src + k);
+			__m128i lo = _mm_unpacklo_epi8(v, zero);
+			__m128i hi = _mm_unpackhi_epi8(v, zero);
+			store(dst + k, _mm_unpacklo_epi16(lo, zero));
+			store(dst + k + 4, _mm_unpackhi_epi16(lo, zero));
+			store(dst + k + 8, _mm_unpacklo_epi16(hi, zero));
+			store(dst + k + 12, _mm_unpackhi_epi16(hi, zero));
+		}
+	}
+	else if constexpr (sizeof(From) == 2 && sizeof(To) == 1)
+	{
+		for (; k + 16 <= n; k += 16)
+		{
+			store(dst + k,
+				  _mm_packus_epi16(load(src + k), load(src + k + 8)));
+		}
+	}
+	else if constexpr (sizeof(From) == 2 && sizeof(To) == 4)
+	{
+		for (; k + 8 <= n; k += 8)
+		{
+			__m128i v = load(src + k);
+			store(dst + k, _mm_unpacklo_epi16(v, zero));
+			store(dst + k + 4, _mm_unpackhi_epi16(v, zero));
+		}
+	}
+	else if constexpr (sizeof(From) == 4 && sizeof(To) == 1)
+	{
+		for (; k + 16 <= n; k += 16)
+		{
+			__m128i lo = _mm_packs_epi32(load(src + k), load(src + k + 4));
+			__m128i hi =
+				_mm_packs_epi32(load(src + k + 8), load(src + k + 12));
+			store(dst + k, _mm_packus_epi16(lo, hi));
+		}
+	}
+	else if constexpr (sizeof(From) == 4 && sizeof(To) == 2)
+	{
+		for (; k + 8 <= n; k += 8)
+		{
+			store(dst + k,
+				  _mm_packs_epi32(load(src + k), load(src + k + 4)));
+		}
+	}
+#endif
+	for (; k < n; ++k)
+	{
+		dst[k] = static_cast<To>(src[k]);
+	}
+}
+
+/// Декодирует одну кодовую точку, начиная с p[i], с проверкой корректности
+template <typename T>
+char32_t decode(const T* p, size_t n, size_t& i)
+{
+	if constexpr (sizeof(T) == 1)
+	{
+		auto byte = [&](size_t k) -> uint32_t
+		{ return static_cast<unsigned char>(p[k]); };
+		uint32_t lead = byte(i);
+		size_t len = 0;
+		uint32_t cp = 0;
+		uint32_t min = 0;
+		if (lead < 0x80)
+		{
+			++i;
+			return lead;
+		}
+		else if ((lead & 0xe0) == 0xc0)
+		{
+			len = 2;
+			cp = lead & 0x1f;
+			min = 0x80;
+		}
+		else if ((lead & 0xf0) == 0xe0)
+		{
+			len = 3;
+			cp = lead & 0x0f;
+			min = 0x800;
+		}
+		else if ((lead & 0xf8) == 0xf0)
+		{
+			len = 4;
+			cp = lead & 0x07;
+			min = 0x10000;
+		}
+		else
+		{
+			transcode_fail();
+		}
+		if (i + len > n)
+		{
+			transcode_fail();
+		}
+		for (size_t k = 1; k < len; ++k)
+		{
+			uint32_t next = byte(i + k);
+			if ((next & 0xc0) != 0x80)
+			{
+				transcode_fail();
+			}
+			cp = (cp << 6) | (next & 0x3f);
+		}
+		if (cp < min || cp > 0x10ffff || (cp >= 0xd800 && cp <= 0xdfff))
+		{
+			transcode_fail();
+		}
+		i += len;
+		return static_cast<char32_t>(cp);
+	}
+	else if constexpr (sizeof(T) == 2)
+	{
+		uint32_t unit = static_cast<utf_unit<T>>(p[i]);
+		if (unit < 0xd800 || unit > 0xdfff)
+		{
+			++i;
+			return static_cast<char32_t>(unit);
+		}
+		if (unit > 0xdbff || i + 1 >= n)
+		{
+			transcode_fail();
+		}
+		uint32_t low = static_cast<utf_unit<T>>(p[i + 1]);
+		if (low < 0xdc00 || low > 0xdfff)
+		{
+			transcode_fail();
+		}
+		i += 2;
+		return static_cast<char32_t>(0x10000 + ((unit - 0xd800) << 10) +
+									 (low - 0xdc00));
+	}
+	else
+	{
+		uint32_t cp = static_cast<utf_unit<T>>(p[i]);
+		if (cp > 0x10ffff || (cp >= 0xd800 && cp <= 0xdfff))
+		{
+			transcode_fail();
+		}
+		++i;
+		return static_cast<char32_t>(cp);
+	}
+}
+
+/// Количество кодовых единиц To для кодовой точки cp
+template <typename To>
+size_t encoded_length(char32_t cp) noexcept
+{
+	if constexpr (sizeof(To) == 1)
+	{
+		return cp < 0x80 ? 1 : cp < 0x800 ? 2 : cp < 0x10000 ? 3 : 4;
+	}
+	else if constexpr (sizeof(To) == 2)
+	{
+		return cp < 0x10000 ? 1 : 2;
+	}
+	else
+	{
+		return 1;
+	}
+}
+
+template <typename To>
+size_t encode(char32_t cp, To* out) noexcept
+{
+	if constexpr (sizeof(To) == 1)
+	{
+		if (cp < 0x80)
+		{
+			out[0] = static_cast<To>(cp);
+			return 1;
+		}
+		if (cp < 0x800)
+		{
+			out[0] = static_cast<To>(0xc0 | (cp >> 6));
+			out[1] = static_cast<To>(0x80 | (cp & 0x3f));
+			return 2;
+		}
+		if (cp < 0x10000)
+		{
+			out[0] = static_cast<To>(0xe0 | (cp >> 12));
+			out[1] = static_cast<To>(0x80 | ((cp >> 6) & 0x3f));
+			out[2] = static_cast<To>(0x80 | (cp & 0x3f));
+			return 3;
+		}
+		out[0] = static_cast<To>(0xf0 | (cp >> 18));
+		out[1] = static_cast<To>(0x80 | ((cp >> 12) & 0x3f));
+		out[2] = static_cast<To>(0x80 | ((cp >> 6) & 0x3f));
+		out[3] = static_cast<To>(0x80 | (cp & 0x3f));
+		return 4;
+	}
+	else if constexpr (sizeof(To) == 2)
+	{
+		if (cp < 0x10000)
+		{
+			out[0] = static_cast<To>(cp);
+			return 1;
+		}
+		cp -= 0x10000;
+		out[0] = static_cast<To>(0xd800 + (cp >> 10));
+		out[1] = static_cast<To>(0xdc00 + (cp & 0x3ff));
+		return 2;
+	}
+	else
+	{
+		out[0] = static_cast<To>(cp);
+		return 1;
+	}
+}
+}  // namespace detail
+
+/// Проверяет, что строка - корректная последовательность UTF-8/16/32
+template <typename T>
+bool is_valid_unicode(const T* src, size_t n) noexcept
+{
+	try
+	{
+		for (size_t i = 0; i < n;)
+		{
+			if (static_cast<detail::utf_unit<T>>(src[i]) < 0x80)
+			{
+				i += detail::ascii_run(src + i, n - i);
+			}
+			else
+			{
+				detail::decode(src, n, i);
+			}
+		}
+	}
+	catch (const std::invalid_argument&)
+	{
+		return false;
+	}
+	return true;
+}
+
+template <typename T>
+bool is_valid_unicode(const basic_string<T>& str) noexcept
+{
+	return is_valid_unicode(str.c_str(), str.size());
+}
+
+/// Перекодирует между UTF-8 (char, char8_t), UTF-16 (char16_t) и UTF-32
+/// (char32_t). Бросает std::invalid_argument на некорректном входе
+template <typename To, typename From>
+basic_string<To> transcode(const From* src, size_t n)
+{
+	size_t len = 0;
+	for (size_t i = 0; i < n;)
+	{
+		if (static_cast<detail::utf_unit<From>>(src[i]) < 0x80)
+		{
+			size_t run = detail::ascii_run(src + i, n - i);
+			i += run;
+			len += run;
+		}
+		else
+		{
+			len += detail::encoded_length<To>(detail::decode(src, n, i));
+		}
+	}
+	basic_string<To> out;
+	out.resize_and_overwrite(
+		len,
+		[src, n](To* dst, size_t count)
+		{
+			for (size_t i = 0; i < n;)
+			{
+				if (static_cast<detail::utf_unit<From>>(src[i]) < 0x80)
+				{
+					size_t run = detail::ascii_run(src + i, n - i);
+					detail::copy_ascii(src + i, dst, run);
+					dst += run;
+					i += run;
+				}
+				else
+				{
+					dst += detail::encode(detail::decode(src, n, i), dst);
+				}
+			}
+			return count;
+		});
+	return out;
+}
+
+template <typename To, typename From>
+basic_string<To> transcode(const basic_string<From>& src)
+{
+	return transcode<To>(src.c_str(), src.size());
+}
+}  // namespace bmstu
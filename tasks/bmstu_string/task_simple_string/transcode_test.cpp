@@ -0,0 +1,88 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include "transcode.h"
+
+TEST(TranscodeTest, Utf8ToUtf16)
+{
+	bmstu::string src("Привет, world! おはよう");
+	auto dst = bmstu::transcode<char16_t>(src);
+	ASSERT_EQ(dst.size(), 19);
+	ASSERT_EQ(std::u16string(dst.c_str()), u"Привет, world! おはよう");
+}
+
+TEST(TranscodeTest, Utf8ToUtf32)
+{
+	bmstu::string src("a\xf0\x9f\x98\x80z");
+	auto dst = bmstu::transcode<char32_t>(src);
+	ASSERT_EQ(dst.size(), 3);
+	ASSERT_EQ(dst[1], U'\U0001F600');
+}
+
+TEST(TranscodeTest, Utf16SurrogatesToUtf8)
+{
+	bmstu::u16string src(u"x\U0001F600y");
+	ASSERT_EQ(src.size(), 4);
+	auto dst = bmstu::transcode<char>(src);
+	ASSERT_STREQ(dst.c_str(), "x\xf0\x9f\x98\x80y");
+}
+
+TEST(TranscodeTest, RoundTripU8String)
+{
+	std::u32string text = U"ASCII prefix long enough for SIMD, затем кириллица, "
+						  U"中文字符 and emoji \U0001F680 at the end";
+	bmstu::u32string src(text.c_str());
+	bmstu::u8string u8 = bmstu::transcode<char8_t>(src);
+	bmstu::u16string u16 = bmstu::transcode<char16_t>(u8);
+	bmstu::u32string back = bmstu::transcode<char32_t>(u16);
+	ASSERT_EQ(back, src);
+	ASSERT_TRUE(bmstu::is_valid_unicode(u8));
+}
+
+TEST(TranscodeTest, LongAscii)
+{
+	std::string text(1000, 'q');
+	text[777] = 'Z';
+	auto dst = bmstu::transcode<char16_t>(bmstu::string(text.c_str()));
+	ASSERT_EQ(dst.size(), 1000);
+	ASSERT_EQ(dst[777], u'Z');
+	auto back = bmstu::transcode<char>(dst);
+	ASSERT_STREQ(back.c_str(), text.c_str());
+}
+
+TEST(TranscodeTest, Empty)
+{
+	bmstu::string src;
+	auto dst = bmstu::transcode<char32_t>(src);
+	ASSERT_EQ(dst.size(), 0);
+	ASSERT_EQ(dst.c_str()[0], U'\0');
+}
+
+TEST(TranscodeTest, InvalidUtf8)
+{
+	const char* bad[] = {"\x80", "\xc0\xaf", "\xe0\x80\xaf", "\xed\xa0\x80",
+						 "\xf4\x90\x80\x80", "abc\xe3\x81", "\xff"};
+	for (const char* s : bad)
+	{
+		bmstu::string src(s);
+		ASSERT_FALSE(bmstu::is_valid_unicode(src)) << s;
+		ASSERT_THROW(bmstu::transcode<char16_t>(src), std::invalid_argument);
+	}
+}
+
+TEST(TranscodeTest, InvalidUtf16)
+{
+	char16_t lone_high[] = {u'a', 0xd800, u'b', 0};
+	char16_t lone_low[] = {0xdc00, 0};
+	ASSERT_THROW(bmstu::transcode<char>(bmstu::u16string(lone_high)),
+				 std::invalid_argument);
+	ASSERT_THROW(bmstu::transcode<char>(bmstu::u16string(lone_low)),
+				 std::invalid_argument);
+}
+
+TEST(TranscodeTest, InvalidUtf32)
+{
+	char32_t too_big[] = {0x110000, 0};
+	ASSERT_THROW(bmstu::transcode<char>(bmstu::u32string(too_big)),
+				 std::invalid_argument);
+}
@@ -0,0 +1,461 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace bmstu
+{
+namespace detail
+{
+using pool_task = std::move_only_function<void()>;
+
+/// Дек Chase-Lev: владелец кладет и берет задачи с нижнего конца без
+/// блокировок, остальные потоки крадут с верхнего одним CAS. Кольцо
+/// растет удвоением; старые кольца живут до разрушения дека, потому что
+/// вор мог успеть прочитать указатель на них
+class work_stealing_deque
+{
+   public:
+	work_stealing_deque()
+	{
+		rings_.push_back(std::make_unique<ring>(64));
+		current_.store(rings_.back().get(), std::memory_order_relaxed);
+	}
+
+	work_stealing_deque(const work_stealing_deque&) = delete;
+	work_stealing_deque& operator=(const work_stealing_deque&) = delete;
+
+	~work_stealing_deque()
+	{
+		while (pool_task* task = pop())
+		{
+			delete task;
+		}
+	}
+
+	/// Только поток-владелец
+	void push(pool_task* task)
+	{
+		int64_t bottom = bottom_.load(std::memory_order_relaxed);
+		int64_t top = top_.load(std::memory_order_acquire);
+		ring* r = current_.load(std::memory_order_relaxed);
+		if (bottom - top >= r->capacity)
+		{
+			r = grow_(r, top, bottom);
+		}
+		r->put(bottom, task);
+		bottom_.store(bottom + 1, std::memory_order_release);
+	}
+
+	/// Только поток-владелец: последняя положенная задача или nullptr
+	pool_task* pop()
+	{
+		int64_t bottom = bottom_.load(std::memory_order_relaxed) - 1;
+		ring* r = current_.load(std::memory_order_relaxed);
+		bottom_.store(bottom, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		int64_t top = top_.load(std::memory_order_relaxed);
+		if (top > bottom)
+		{
+			bottom_.store(bottom + 1, std::memory_order_relaxed);
+			return nullptr;
+		}
+		pool_task* task = r->get(bottom);
+		if (top == bottom)
+		{
+			// Последний элемент: гонка с ворами решается тем же CAS
+			if (!top_.compare_exchange_strong(top, top + 1,
+											  std::memory_order_seq_cst,
+											  std::memory_order_relaxed))
+			{
+				task = nullptr;
+			}
+			bottom_.store(bottom + 1, std::memory_order_relaxed);
+		}
+		return task;
+	}
+
+	/// Любой поток: самая старая задача или nullptr, если дек пуст или
+	/// задачу забрал кто-то другой
+	pool_task* steal()
+	{
+		int64_t top = top_.load(std::memory_order_acquire);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		int64_t bottom = bottom_.load(std::memory_order_acquire);
+		if (top >= bottom)
+		{
+			return nullptr;
+		}
+		pool_task* task = current_.load(std::memory_order_acquire)->get(top);
+		if (!top_.compare_exchange_strong(top, top + 1,
+										  std::memory_order_seq_cst,
+										  std::memory_order_relaxed))
+		{
+			return nullptr;
+		}
+		return task;
+	}
+
+   private:
+	struct ring
+	{
+		explicit ring(int64_t size)
+			: capacity(size), slots(new std::atomic<pool_task*>[size])
+		{
+		}
+
+		pool_task* get(int64_t index) const noexcept
+		{
+			return slots[index & (capacity - 1)].load(
+				std::memory_order_acquire);
+		}
+
+		void put(int64_t index, pool_task* task) noexcept
+		{
+			slots[index & (capacity - 1)].store(task,
+												std::memory_order_release);
+		}
+
+		int64_t capacity;
+		std::unique_ptr<std::atomic<pool_task*>[]> slots;
+	};
+
+	ring* grow_(ring* old, int64_t top, int64_t bottom)
+	{
+		auto fresh = std::make_unique<ring>(old->capacity * 2);
+		for (int64_t i = top; i < bottom; ++i)
+		{
+			fresh->put(i, old->get(i));
+		}
+		ring* r = fresh.get();
+		rings_.push_back(std::move(fresh));
+		current_.store(r, std::memory_order_release);
+		return r;
+	}
+
+	std::atomic<int64_t> top_{0};
+	std::atomic<int64_t> bottom_{0};
+	std::atomic<ring*> current_{nullptr};
+	std::vector<std::unique_ptr<ring>> rings_;
+};
+}  // namespace detail
+
+/// Пул потоков с кражей работы. У каждого рабочего свой дек Chase-Lev:
+/// задачи, порожденные внутри пула, кладутся в дек своего потока, задачи
+/// извне - в общую очередь; простаивающий рабочий крадет у других.
+/// submit возвращает std::future, wait ждет все поставленные задачи,
+/// parallel_for делит диапазон на куски сам. Деструктор дожидается уже
+/// поставленных задач
+class thread_pool
+{
+   public:
+	explicit thread_pool(size_t threads = default_threads())
+	{
+		threads = std::max<size_t>(1, threads);
+		deques_.reserve(threads);
+		for (size_t i = 0; i < threads; ++i)
+		{
+			deques_.push_back(std::make_unique<detail::work_stealing_deque>());
+		}
+		workers_.reserve(threads);
+		for (size_t i = 0; i < threads; ++i)
+		{
+			workers_.emplace_back([this, i] { work_(i); });
+		}
+	}
+
+	thread_pool(const thread_pool&) = delete;
+	thread_pool& operator=(const thread_pool&) = delete;
+
+	~thread_pool()
+	{
+		{
+			std::lock_guard lock(mutex_);
+			stopping_ = true;
+		}
+		ready_.notify_all();
+		for (std::thread& worker : workers_)
+		{
+			worker.join();
+		}
+	}
+
+	size_t size() const noexcept { return deques_.size(); }
+
+	template <typename F>
+	auto submit(F&& task) -> std::future<std::invoke_result_t<std::decay_t<F>>>
+	{
+		using result = std::invoke_result_t<std::decay_t<F>>;
+		std::packaged_task<result()> packaged(std::forward<F>(task));
+		auto future = packaged.get_future();
+		push_(new detail::pool_task(std::move(packaged)));
+		return future;
+	}
+
+	/// Задача без future. Исключение из нее, как из std::thread,
+	/// завершает программу
+	template <typename F>
+	void post(F&& task)
+	{
+		push_(new detail::pool_task(std::forward<F>(task)));
+	}
+
+	/// Ждет, пока выполнятся все поставленные задачи, включая порожденные
+	/// ими. Вызывается не из задач этого пула
+	void wait()
+	{
+		if (current_pool_ == this)
+		{
+			throw std::logic_error("thread_pool::wait called from its task");
+		}
+		std::unique_lock lock(mutex_);
+		waiters_.fetch_add(1);
+		done_.wait(lock, [this] { return unfinished_.load() == 0; });
+		waiters_.fetch_sub(1);
+	}
+
+	/// Вызывает body(i) для каждого i из [first, last) или body(lo, hi) для
+	/// кусков, если body принимает два индекса. Диапазон делится пополам,
+	/// пока кусок больше grain (0 - около 8 кусков на поток); вызывающий
+	/// поток работает вместе с пулом, поэтому parallel_for можно вызывать и
+	/// из задач. Первое исключение из body пробрасывается после завершения
+	template <typename F>
+	void parallel_for(size_t first, size_t last, F&& body, size_t grain = 0)
+	{
+		if (first >= last)
+		{
+			return;
+		}
+		if (grain == 0)
+		{
+			grain = std::max<size_t>(1, (last - first) / (size() * 8));
+		}
+		for_state<std::remove_reference_t<F>> state(body, grain);
+		run_range_(state, first, last);
+		while (state.pending.load(std::memory_order_acquire) != 0)
+		{
+			if (!run_one_())
+			{
+				std::this_thread::yield();
+			}
+		}
+		if (state.error)
+		{
+			std::rethrow_exception(state.error);
+		}
+	}
+
+	/// Выполняет одну ожидающую задачу пула в вызывающем потоке; false,
+	/// если задач нет. Для ожиданий, которые не должны занимать рабочий
+	/// поток впустую
+	bool run_pending() { return run_one_(); }
+
+	/// Общий пул на все аппаратные потоки
+	static thread_pool& shared()
+	{
+		static thread_pool pool;
+		return pool;
+	}
+
+	static size_t default_threads() noexcept
+	{
+		return std::max(1u, std::thread::hardware_concurrency());
+	}
+
+   private:
+	/// Сколько кругов кражи рабочий делает перед тем, как уснуть
+	static constexpr int spin_rounds_ = 64;
+
+	template <typename F>
+	struct for_state
+	{
+		/// Весь диапазон - один кусок, его выполняет вызывающий поток
+		for_state(F& body, size_t grain) noexcept : body(body), grain(grain) {}
+
+		F& body;
+		size_t grain;
+		/// Куски, которые еще выполняются или ждут в деках
+		std::atomic<size_t> pending{1};
+		std::atomic<bool> failed{false};
+		std::exception_ptr error;
+	};
+
+	/// Отдает правую половину в пул, пока кусок крупнее grain, затем
+	/// выполняет остаток. pending уменьшается последним обращением к state
+	template <typename F>
+	void run_range_(for_state<F>& state, size_t first, size_t last)
+	{
+		while (last - first > state.grain)
+		{
+			size_t middle = first + (last - first) / 2;
+			state.pending.fetch_add(1, std::memory_order_relaxed);
+			push_(new detail::pool_task([this, &state, middle, last]
+										{ run_range_(state, middle, last); }));
+			last = middle;
+		}
+		if (!state.failed.load(std::memory_order_relaxed))
+		{
+			try
+			{
+				if constexpr (std::is_invocable_v<F&, size_t, size_t>)
+				{
+					state.body(first, last);
+				}
+				else
+				{
+					for (size_t i = first; i < last; ++i)
+					{
+						state.body(i);
+					}
+				}
+			}
+			catch (...)
+			{
+				if (!state.failed.exchange(true))
+				{
+					state.error = std::current_exception();
+				}
+			}
+		}
+		state.pending.fetch_sub(1, std::memory_order_release);
+	}
+
+	void push_(detail::pool_task* task)
+	{
+		unfinished_.fetch_add(1);
+		if (current_pool_ == this)
+		{
+			deques_[current_index_]->push(task);
+		}
+		else
+		{
+			std::lock_guard lock(inject_mutex_);
+			injected_.push_back(task);
+			injected_size_.fetch_add(1, std::memory_order_relaxed);
+		}
+		queued_.fetch_add(1);
+		if (sleepers_.load() > 0)
+		{
+			std::lock_guard lock(mutex_);
+			ready_.notify_one();
+		}
+	}
+
+	/// Своя задача, затем общая очередь, затем кража у остальных
+	detail::pool_task* find_task_()
+	{
+		detail::pool_task* task = nullptr;
+		size_t self = current_pool_ == this ? current_index_ : size();
+		if (self != size())
+		{
+			task = deques_[self]->pop();
+		}
+		if (task == nullptr &&
+			injected_size_.load(std::memory_order_relaxed) != 0)
+		{
+			std::lock_guard lock(inject_mutex_);
+			if (!injected_.empty())
+			{
+				task = injected_.front();
+				injected_.pop_front();
+				injected_size_.fetch_sub(1, std::memory_order_relaxed);
+			}
+		}
+		for (size_t i = 0; task == nullptr && i < size(); ++i)
+		{
+			size_t victim = (self + 1 + i) % size();
+			if (victim != self)
+			{
+				task = deques_[victim]->steal();
+			}
+		}
+		if (task != nullptr)
+		{
+			queued_.fetch_sub(1);
+		}
+		return task;
+	}
+
+	bool run_one_()
+	{
+		detail::pool_task* task = find_task_();
+		if (task == nullptr)
+		{
+			return false;
+		}
+		(*task)();
+		delete task;
+		if (unfinished_.fetch_sub(1) == 1 && waiters_.load() > 0)
+		{
+			std::lock_guard lock(mutex_);
+			done_.notify_all();
+		}
+		return true;
+	}
+
+	void work_(size_t index)
+	{
+		current_pool_ = this;
+		current_index_ = index;
+		while (true)
+		{
+			bool ran = false;
+			for (int round = 0; round < spin_rounds_ && !ran; ++round)
+			{
+				ran = run_one_();
+				if (!ran)
+				{
+					std::this_thread::yield();
+				}
+			}
+			if (ran)
+			{
+				continue;
+			}
+			std::unique_lock lock(mutex_);
+			sleepers_.fetch_add(1);
+			ready_.wait(lock,
+						[this] { return stopping_ || queued_.load() > 0; });
+			sleepers_.fetch_sub(1);
+			if (stopping_ && queued_.load() <= 0)
+			{
+				return;
+			}
+		}
+	}
+
+	static inline thread_local thread_pool* current_pool_ = nullptr;
+	static inline thread_local size_t current_index_ = 0;
+
+	std::vector<std::unique_ptr<detail::work_stealing_deque>> deques_;
+	std::mutex inject_mutex_;
+	std::deque<detail::pool_task*> injected_;
+	/// Размер injected_ для проверки без блокировки
+	std::atomic<size_t> injected_size_{0};
+	/// Задачи в деках и очереди; может кратко уйти в минус, пока push_
+	/// еще не учел задачу, которую уже забрали
+	std::atomic<int64_t> queued_{0};
+	/// Поставленные и еще не завершенные задачи
+	std::atomic<int64_t> unfinished_{0};
+	std::atomic<int> sleepers_{0};
+	std::atomic<int> waiters_{0};
+	std::mutex mutex_;
+	std::condition_variable ready_;
+	std::condition_variable done_;
+	bool stopping_ = false;
+	std::vector<std::thread> workers_;
+};
+}  // namespace bmstu
@@ -0,0 +1,162 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+#include "thread_pool.h"
+
+TEST(ThreadPoolTest, SubmitReturnsResult)
+{
+	bmstu::thread_pool pool(4);
+	ASSERT_EQ(pool.size(), 4u);
+	std::vector<std::future<int>> results;
+	for (int i = 0; i < 100; ++i)
+	{
+		results.push_back(pool.submit([i] { return i * i; }));
+	}
+	int sum = 0;
+	for (auto& result : results)
+	{
+		sum += result.get();
+	}
+	ASSERT_EQ(sum, 328350);
+}
+
+TEST(ThreadPoolTest, ExceptionReachesFuture)
+{
+	bmstu::thread_pool pool(2);
+	auto failed =
+		pool.submit([]() -> int { throw std::runtime_error("task"); });
+	ASSERT_THROW(failed.get(), std::runtime_error);
+	ASSERT_EQ(pool.submit([] { return 7; }).get(), 7);
+}
+
+TEST(ThreadPoolTest, PostAcceptsMoveOnlyTasks)
+{
+	bmstu::thread_pool pool(2);
+	std::atomic<int> sum = 0;
+	for (int i = 0; i < 100; ++i)
+	{
+		auto value = std::make_unique<int>(i);
+		pool.post([&sum, value = std::move(value)] { sum += *value; });
+	}
+	pool.wait();
+	ASSERT_EQ(sum.load(), 4950);
+}
+
+TEST(ThreadPoolTest, DestructorDrainsQueue)
+{
+	std::atomic<int> done = 0;
+	{
+		bmstu::thread_pool pool(2);
+		for (int i = 0; i < 1000; ++i)
+		{
+			pool.submit([&done] { done.fetch_add(1); });
+		}
+	}
+	ASSERT_EQ(done.load(), 1000);
+}
+
+TEST(ThreadPoolTest, IdleWorkersStealSpawnedTasks)
+{
+	bmstu::thread_pool pool(4);
+	std::atomic<int> done = 0;
+	// Подзадачи лежат в деке занятого потока, выполнить их могут только
+	// другие рабочие, укравшие их
+	pool.submit(
+			[&]
+			{
+				for (int i = 0; i < 100; ++i)
+				{
+					pool.submit([&done] { done.fetch_add(1); });
+				}
+				while (done.load() != 100)
+				{
+					std::this_thread::yield();
+				}
+			})
+		.get();
+	ASSERT_EQ(done.load(), 100);
+}
+
+TEST(ThreadPoolTest, WaitIncludesSpawnedTasks)
+{
+	bmstu::thread_pool pool(3);
+	std::atomic<int> done = 0;
+	for (int i = 0; i < 10; ++i)
+	{
+		pool.submit(
+			[&]
+			{
+				for (int j = 0; j < 10; ++j)
+				{
+					pool.submit([&done] { done.fetch_add(1); });
+				}
+			});
+	}
+	pool.wait();
+	ASSERT_EQ(done.load(), 100);
+	auto nested = pool.submit([&pool] { pool.wait(); });
+	ASSERT_THROW(nested.get(), std::logic_error);
+}
+
+TEST(ThreadPoolTest, ParallelForCoversRange)
+{
+	bmstu::thread_pool pool(4);
+	std::vector<int> hits(100000);
+	pool.parallel_for(0, hits.size(), [&](size_t i) { ++hits[i]; });
+	ASSERT_TRUE(std::all_of(hits.begin(), hits.end(),
+							[](int h) { return h == 1; }));
+
+	std::atomic<size_t> chunks = 0;
+	std::atomic<size_t> covered = 0;
+	pool.parallel_for(
+		10, 1010,
+		[&](size_t first, size_t last)
+		{
+			ASSERT_LE(last - first, 100u);
+			chunks.fetch_add(1);
+			covered.fetch_add(last - first);
+		},
+		100);
+	ASSERT_EQ(covered.load(), 1000u);
+	ASSERT_GE(chunks.load(), 10u);
+	pool.parallel_for(5, 5, [](size_t) { FAIL(); });
+}
+
+TEST(ThreadPoolTest, NestedParallelFor)
+{
+	bmstu::thread_pool pool(2);
+	std::vector<int64_t> sums(64);
+	pool.parallel_for(0, sums.size(),
+					  [&](size_t row)
+					  {
+						  std::atomic<int64_t> sum = 0;
+						  pool.parallel_for(0, 1000, [&](size_t i)
+											{ sum.fetch_add(int64_t(i)); });
+						  sums[row] = sum.load();
+					  });
+	ASSERT_TRUE(std::all_of(sums.begin(), sums.end(),
+							[](int64_t s) { return s == 499500; }));
+}
+
+TEST(ThreadPoolTest, ParallelForRethrows)
+{
+	bmstu::thread_pool pool(4);
+	std::atomic<int> calls = 0;
+	ASSERT_THROW(pool.parallel_for(0, 1000,
+								   [&](size_t i)
+								   {
+									   calls.fetch_add(1);
+									   if (i == 500)
+									   {
+										   throw std::runtime_error("body");
+									   }
+								   }),
+				 std::runtime_error);
+	ASSERT_LE(calls.load(), 1000);
+	ASSERT_EQ(pool.submit([] { return 1; }).get(), 1);
+}
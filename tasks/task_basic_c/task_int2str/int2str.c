@@ -1,9 +1,195 @@
 #include "int2str.h"
-#include <assert.h>
 #include "stdio.h"
 
+#if defined(_MSC_VER)
+#define THREAD_LOCAL __declspec(thread)
+#else
+#define THREAD_LOCAL _Thread_local
+#endif
+
+/* Пары цифр 00..99: число раскладывается по две цифры за шаг */
+static const char digits2[201] =
+	"00010203040506070809"
+	"10111213141516171819"
+	"20212223242526272829"
+	"30313233343536373839"
+	"40414243444546474849"
+	"50515253545556575859"
+	"60616263646566676869"
+	"70717273747576777879"
+	"80818283848586878889"
+	"90919293949596979899";
+
+/* Количество десятичных цифр: по четыре разряда за шаг. Вариант без
+ * ветвлений через clz и таблицу степеней десяти на замерах медленнее: запись
+ * цифр ждет цепочку bsr-imul-load, а ветвления предсказатель проходит
+ * спекулятивно */
+static size_t count_digits(uint64_t value)
+{
+	size_t digits = 1;
+	for (;;)
+	{
+		if (value < 10)
+		{
+			return digits;
+		}
+		if (value < 100)
+		{
+			return digits + 1;
+		}
+		if (value < 1000)
+		{
+			return digits + 2;
+		}
+		if (value < 10000)
+		{
+			return digits + 3;
+		}
+		value /= 10000;
+		digits += 4;
+	}
+}
+
+static void write_digits32(uint32_t value, char* end)
+{
+	while (value >= 100)
+	{
+		const char* pair = digits2 + (value % 100) * 2;
+		value /= 100;
+		*--end = pair[1];
+		*--end = pair[0];
+	}
+	if (value >= 10)
+	{
+		const char* pair = digits2 + value * 2;
+		*--end = pair[1];
+		*--end = pair[0];
+	}
+	else
+	{
+		*--end = (char)('0' + value);
+	}
+}
+
+/* 64-битное деление дороже 32-битного, поэтому старшие разряды снимаются
+ * блоками по восемь цифр, а остаток печатается 32-битным циклом */
+static void write_digits(uint64_t value, char* end)
+{
+	while (value > UINT32_MAX)
+	{
+		uint32_t low = (uint32_t)(value % 100000000);
+		value /= 100000000;
+		for (int i = 0; i < 4; ++i)
+		{
+			const char* pair = digits2 + (low % 100) * 2;
+			low /= 100;
+			*--end = pair[1];
+			*--end = pair[0];
+		}
+	}
+	write_digits32((uint32_t)value, end);
+}
+
+static uint32_t magnitude32(int number)
+{
+	return number < 0 ? 0u - (uint32_t)number : (uint32_t)number;
+}
+
+static size_t format32(uint32_t magnitude, int negative, char* buf, size_t len)
+{
+	size_t total = count_digits(magnitude) + (size_t)negative;
+	if (buf == NULL || len <= total)
+	{
+		return 0;
+	}
+	buf[0] = '-';
+	write_digits32(magnitude, buf + total);
+	buf[total] = '\0';
+	return total;
+}
+
+static size_t format(uint64_t magnitude, int negative, char* buf, size_t len)
+{
+	size_t total = count_digits(magnitude) + (size_t)negative;
+	if (buf == NULL || len <= total)
+	{
+		return 0;
+	}
+	buf[0] = '-';
+	write_digits(magnitude, buf + total);
+	buf[total] = '\0';
+	return total;
+}
+
+size_t uint64_2str_r(uint64_t number, char* buf, size_t len)
+{
+	return format(number, 0, buf, len);
+}
+
+size_t int64_2str_r(int64_t number, char* buf, size_t len)
+{
+	uint64_t magnitude =
+		number < 0 ? 0 - (uint64_t)number : (uint64_t)number;
+	return format(magnitude, number < 0, buf, len);
+}
+
+size_t uint2str_r(unsigned number, char* buf, size_t len)
+{
+	return format32(number, 0, buf, len);
+}
+
+size_t int2str_r(int number, char* buf, size_t len)
+{
+	return format32(magnitude32(number), number < 0, buf, len);
+}
+
+size_t int2str_array_size(const int* values, size_t count)
+{
+	size_t total = count == 0 ? 0 : count - 1;
+	for (size_t i = 0; i < count; ++i)
+	{
+		total += count_digits(magnitude32(values[i])) + (values[i] < 0);
+	}
+	return total;
+}
+
+/* Пишет count > 0 чисел через delim без завершающего символа */
+static void write_array(const int* values, size_t count, char delim, char* out)
+{
+	for (size_t i = 0;; ++i)
+	{
+		uint32_t magnitude = magnitude32(values[i]);
+		size_t total = count_digits(magnitude) + (values[i] < 0);
+		out[0] = '-';
+		write_digits32(magnitude, out + total);
+		out += total;
+		if (i + 1 == count)
+		{
+			break;
+		}
+		*out++ = delim;
+	}
+}
+
+size_t int2str_array(const int* values, size_t count, char delim, char* buf,
+					 size_t len)
+{
+	size_t total = int2str_array_size(values, count);
+	if (buf == NULL || len <= total)
+	{
+		return 0;
+	}
+	if (count != 0)
+	{
+		write_array(values, count, delim, buf);
+	}
+	buf[total] = '\0';
+	return total;
+}
+
 char* int2str(int number)
 {
-	char* str = "0";
+	static THREAD_LOCAL char str[12];
+	int2str_r(number, str, sizeof(str));
 	return str;
 }
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <stddef.h>
+#include <stdint.h>
+
 #ifdef __cplusplus
 extern "C"
 {
@@ -7,6 +10,28 @@ extern "C"
 
 	char* int2str(int number);
 
+	/* Реентерабельные варианты: пишут число и '\0' в buf длиной len и
+	 * возвращают количество записанных символов без '\0'. Если буфер мал,
+	 * возвращают 0 и ничего не пишут. Хватает буфера на 21 символ. */
+	size_t int2str_r(int number, char* buf, size_t len);
+	size_t uint2str_r(unsigned number, char* buf, size_t len);
+	size_t int64_2str_r(int64_t number, char* buf, size_t len);
+	size_t uint64_2str_r(uint64_t number, char* buf, size_t len);
+
+	/* Точная длина записи массива с односимвольными разделителями, без '\0' */
+	size_t int2str_array_size(const int* values, size_t count);
+
+	/* Пишет values через delim и '\0' в buf длиной len, возвращает длину без
+	 * '\0'. Если буфер мал (len <= int2str_array_size), возвращает 0 */
+	size_t int2str_array(const int* values, size_t count, char delim, char* buf,
+						 size_t len);
+
+	/* То же, но массив делится на части по потокам (не больше threads): каждая
+	 * часть считает свою длину, затем пишет себя по готовому смещению.
+	 * Реализация на std::thread в int2str_array.cpp */
+	size_t int2str_array_mt(const int* values, size_t count, char delim,
+							char* buf, size_t len, unsigned threads);
+
 #ifdef __cplusplus
 }
 #endif
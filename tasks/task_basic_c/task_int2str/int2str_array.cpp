@@ -0,0 +1,67 @@
+#include <algorithm>
+#include <thread>
+#include <vector>
+#include "int2str.h"
+
+namespace
+{
+/// Меньше этого числа элементов на поток запуск потока не окупается
+constexpr size_t min_chunk = 16384;
+
+/// Выполняет job(i) для частей 1..parts-1 в потоках, часть 0 на месте
+template <typename Job>
+void run_parts(size_t parts, Job job)
+{
+	std::vector<std::thread> workers;
+	workers.reserve(parts - 1);
+	for (size_t i = 1; i < parts; ++i)
+	{
+		workers.emplace_back(job, i);
+	}
+	job(0);
+	for (std::thread& worker : workers)
+	{
+		worker.join();
+	}
+}
+}  // namespace
+
+size_t int2str_array_mt(const int* values, size_t count, char delim, char* buf,
+						size_t len, unsigned threads)
+{
+	size_t parts = std::min<size_t>(count / min_chunk, threads);
+	if (parts <= 1 || buf == nullptr)
+	{
+		return int2str_array(values, count, delim, buf, len);
+	}
+	size_t step = count / parts;
+	auto first = [&](size_t i) { return values + i * step; };
+	auto size = [&](size_t i)
+	{ return i + 1 == parts ? count - i * step : step; };
+
+	std::vector<size_t> offsets(parts + 1);
+	run_parts(parts, [&](size_t i)
+			  { offsets[i + 1] = int2str_array_size(first(i), size(i)) + 1; });
+	for (size_t i = 0; i < parts; ++i)
+	{
+		offsets[i + 1] += offsets[i];
+	}
+	size_t total = offsets[parts] - 1;
+	if (len <= total)
+	{
+		return 0;
+	}
+	// Завершающий ноль каждой части попадает на место разделителя перед
+	// следующей и заменяется после того, как все части записаны
+	run_parts(parts,
+			  [&](size_t i)
+			  {
+				  int2str_array(first(i), size(i), delim, buf + offsets[i],
+								offsets[i + 1] - offsets[i]);
+			  });
+	for (size_t i = 1; i < parts; ++i)
+	{
+		buf[offsets[i] - 1] = delim;
+	}
+	return total;
+}
@@ -1,6 +1,9 @@
 // NOLINTBEGIN
 #include <gtest/gtest.h>
 // NOLINTEND
+#include <cstdint>
+#include <string>
+#include <vector>
 #include "int2str.h"
 
 TEST(int2str, BasicTest)
@@ -26,3 +29,94 @@ TEST(int2str, BasicTestNumbers)
 	EXPECT_STREQ(int2str(2147483647), "2147483647");
 	EXPECT_STREQ(int2str(-2147483648), "-2147483648");
 }
+
+TEST(int2str, ReentrantBasic)
+{
+	char buf[32];
+	ASSERT_EQ(int2str_r(0, buf, sizeof(buf)), 1u);
+	EXPECT_STREQ(buf, "0");
+	ASSERT_EQ(int2str_r(-2147483647 - 1, buf, sizeof(buf)), 11u);
+	EXPECT_STREQ(buf, "-2147483648");
+	ASSERT_EQ(uint2str_r(4294967295u, buf, sizeof(buf)), 10u);
+	EXPECT_STREQ(buf, "4294967295");
+}
+
+TEST(int2str, Reentrant64)
+{
+	char buf[32];
+	ASSERT_EQ(int64_2str_r(INT64_MIN, buf, sizeof(buf)), 20u);
+	EXPECT_STREQ(buf, "-9223372036854775808");
+	ASSERT_EQ(int64_2str_r(INT64_MAX, buf, sizeof(buf)), 19u);
+	EXPECT_STREQ(buf, "9223372036854775807");
+	ASSERT_EQ(uint64_2str_r(UINT64_MAX, buf, sizeof(buf)), 20u);
+	EXPECT_STREQ(buf, "18446744073709551615");
+}
+
+TEST(int2str, ReentrantDigitBoundaries)
+{
+	char buf[32];
+	uint64_t power = 1;
+	for (int digits = 1; digits <= 20; ++digits)
+	{
+		ASSERT_EQ(uint64_2str_r(power, buf, sizeof(buf)), (size_t)digits);
+		ASSERT_EQ(std::to_string(power), buf);
+		if (digits > 1)
+		{
+			ASSERT_EQ(uint64_2str_r(power - 1, buf, sizeof(buf)),
+					  (size_t)digits - 1);
+			ASSERT_EQ(std::to_string(power - 1), buf);
+		}
+		if (digits < 20)
+		{
+			power *= 10;
+		}
+	}
+}
+
+TEST(int2str, ReentrantSmallBuffer)
+{
+	char buf[4] = {'x', 'x', 'x', 'x'};
+	ASSERT_EQ(int2str_r(1234, buf, sizeof(buf)), 0u);
+	ASSERT_EQ(buf[0], 'x');
+	ASSERT_EQ(int2str_r(-12, buf, sizeof(buf)), 3u);
+	EXPECT_STREQ(buf, "-12");
+	ASSERT_EQ(int2str_r(5, nullptr, 0), 0u);
+}
+
+TEST(int2str, Array)
+{
+	const int values[] = {0, -1, 42, 2147483647, -2147483647 - 1, 100};
+	const char expected[] = "0,-1,42,2147483647,-2147483648,100";
+	ASSERT_EQ(int2str_array_size(values, 6), sizeof(expected) - 1);
+	char buf[64];
+	ASSERT_EQ(int2str_array(values, 6, ',', buf, sizeof(buf)),
+			  sizeof(expected) - 1);
+	EXPECT_STREQ(buf, expected);
+	ASSERT_EQ(int2str_array(values, 6, ',', buf, sizeof(expected) - 1), 0u);
+	ASSERT_EQ(int2str_array(values, 0, ',', buf, 1), 0u);
+	EXPECT_STREQ(buf, "");
+}
+
+TEST(int2str, ArrayMultithreaded)
+{
+	std::vector<int> values(100000);
+	std::string expected;
+	for (size_t i = 0; i < values.size(); ++i)
+	{
+		values[i] = static_cast<int>(i * 2654435761u);
+		expected += std::to_string(values[i]);
+		expected += '\n';
+	}
+	expected.pop_back();
+	std::string buf(expected.size() + 1, 'x');
+	for (unsigned threads : {1u, 2u, 3u, 8u})
+	{
+		ASSERT_EQ(int2str_array_mt(values.data(), values.size(), '\n',
+								   buf.data(), buf.size(), threads),
+				  expected.size());
+		ASSERT_EQ(buf.c_str(), expected);
+	}
+	ASSERT_EQ(int2str_array_mt(values.data(), values.size(), '\n', buf.data(),
+							   expected.size(), 4),
+			  0u);
+}
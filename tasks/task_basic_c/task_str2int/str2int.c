@@ -1,8 +1,213 @@
 #include "str2int.h"
-#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
 #include "stdio.h"
 
+/* Восемь ASCII-цифр как одно 64-битное слово, младший адрес в младшем байте */
+static uint64_t load8(const char* p)
+{
+	uint64_t chunk;
+	memcpy(&chunk, p, sizeof(chunk));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+	chunk = __builtin_bswap64(chunk);
+#endif
+	return chunk;
+}
+
+/* Все восемь байт лежат в '0'..'9': старшая тетрада каждого равна 3 и
+ * остается 3 после прибавления 6 к младшей */
+static int is_eight_digits(uint64_t chunk)
+{
+	return ((chunk & 0xF0F0F0F0F0F0F0F0ull) |
+			(((chunk + 0x0606060606060606ull) & 0xF0F0F0F0F0F0F0F0ull) >> 4)) ==
+		   0x3333333333333333ull;
+}
+
+/* Длина ведущего отрезка цифр в [p, end). Ненулевая старшая тетрада в маске
+ * отмечает нецифру; перенос от +6 уходит только в байты после первой
+ * нецифры, поэтому младший отмеченный байт определяется верно */
+static size_t digit_run(const char* p, const char* end)
+{
+	const char* start = p;
+	while (end - p >= 8)
+	{
+		uint64_t chunk = load8(p);
+		uint64_t mask =
+			((chunk & 0xF0F0F0F0F0F0F0F0ull) ^ 0x3030303030303030ull) |
+			(((chunk + 0x0606060606060606ull) & 0xF0F0F0F0F0F0F0F0ull) ^
+			 0x3030303030303030ull);
+		if (mask != 0)
+		{
+#if defined(_MSC_VER)
+			unsigned long index;
+			_BitScanForward64(&index, mask);
+			return (size_t)(p - start) + index / 8;
+#else
+			return (size_t)(p - start) + (size_t)__builtin_ctzll(mask) / 8;
+#endif
+		}
+		p += 8;
+	}
+	while (p < end && (unsigned)(unsigned char)*p - '0' <= 9)
+	{
+		++p;
+	}
+	return (size_t)(p - start);
+}
+
+/* SWAR: пары цифр, затем четверки, затем восьмерка за три умножения */
+static uint32_t parse_eight(uint64_t chunk)
+{
+	const uint64_t mask = 0x000000FF000000FFull;
+	const uint64_t mul1 = 100 + (1000000ull << 32);
+	const uint64_t mul2 = 1 + (10000ull << 32);
+	chunk -= 0x3030303030303030ull;
+	chunk = chunk * 10 + (chunk >> 8);
+	chunk = ((chunk & mask) * mul1 + ((chunk >> 16) & mask) * mul2) >> 32;
+	return (uint32_t)chunk;
+}
+
+/* Не больше 19 цифр, поэтому в uint64_t переполнения нет и проверить
+ * диапазон можно одним сравнением в конце */
+static int parse_digits(const char* p, size_t count, uint64_t* value)
+{
+	uint64_t result = 0;
+	unsigned bad = 0;
+	for (; count >= 8; p += 8, count -= 8)
+	{
+		uint64_t chunk = load8(p);
+		if (!is_eight_digits(chunk))
+		{
+			return STR2INT_INVALID;
+		}
+		result = result * 100000000 + parse_eight(chunk);
+	}
+	for (; count > 0; ++p, --count)
+	{
+		unsigned digit = (unsigned)(unsigned char)*p - '0';
+		bad |= digit > 9;
+		result = result * 10 + digit;
+	}
+	*value = result;
+	return bad ? STR2INT_INVALID : STR2INT_OK;
+}
+
+/* Общий разбор знака и модуля; limit - наибольший положительный модуль */
+static int parse_signed(const char* str, size_t len, uint64_t limit,
+						size_t max_digits, uint64_t* magnitude, int* negative)
+{
+	if (len == 0)
+	{
+		return STR2INT_EMPTY;
+	}
+	*negative = str[0] == '-';
+	if (str[0] == '-' || str[0] == '+')
+	{
+		++str;
+		--len;
+	}
+	if (len == 0)
+	{
+		return STR2INT_INVALID;
+	}
+	while (len > 1 && str[0] == '0')
+	{
+		++str;
+		--len;
+	}
+	if (len > max_digits)
+	{
+		for (size_t i = 0; i < len; ++i)
+		{
+			if ((unsigned)(unsigned char)str[i] - '0' > 9)
+			{
+				return STR2INT_INVALID;
+			}
+		}
+		return STR2INT_OVERFLOW;
+	}
+	int status = parse_digits(str, len, magnitude);
+	if (status != STR2INT_OK)
+	{
+		return status;
+	}
+	return *magnitude > limit + (uint64_t)*negative ? STR2INT_OVERFLOW
+													: STR2INT_OK;
+}
+
+int str2int64_n(const char* str, size_t len, int64_t* out)
+{
+	uint64_t magnitude;
+	int negative;
+	int status =
+		parse_signed(str, len, INT64_MAX, 19, &magnitude, &negative);
+	if (status == STR2INT_OK)
+	{
+		*out = negative ? (int64_t)(0 - magnitude) : (int64_t)magnitude;
+	}
+	return status;
+}
+
+int str2int_n(const char* str, size_t len, int* out)
+{
+	uint64_t magnitude;
+	int negative;
+	int status = parse_signed(str, len, INT32_MAX, 10, &magnitude, &negative);
+	if (status == STR2INT_OK)
+	{
+		*out = negative ? (int)(0 - (uint32_t)magnitude) : (int)magnitude;
+	}
+	return status;
+}
+
+int str2int_batch(const char* buf, size_t len, char delim, int* out,
+				  size_t capacity, size_t* parsed)
+{
+	const char* end = buf + len;
+	size_t count = 0;
+	int status = STR2INT_OK;
+	while (buf < end)
+	{
+		const char* digits = buf + (*buf == '-' || *buf == '+');
+		const char* stop = digits + digit_run(digits, end);
+		if (stop != end && *stop != delim)
+		{
+			stop = memchr(stop, delim, (size_t)(end - stop));
+			if (stop == NULL)
+			{
+				stop = end;
+			}
+		}
+		if (count == capacity)
+		{
+			status = STR2INT_NO_SPACE;
+			break;
+		}
+		status = str2int_n(buf, (size_t)(stop - buf), out + count);
+		if (status != STR2INT_OK)
+		{
+			break;
+		}
+		++count;
+		buf = stop + 1;
+	}
+	if (parsed != NULL)
+	{
+		*parsed = count;
+	}
+	return status;
+}
+
 int str2int(const char* str)
 {
-	return 0;
+	int result = 0;
+	if (str2int_n(str, strlen(str), &result) != STR2INT_OK)
+	{
+		fprintf(stderr, "str2int: \"%s\" is not an int\n", str);
+		abort();
+	}
+	return result;
 }
@@ -1,12 +1,36 @@
 #pragma once
 
+#include <stddef.h>
+#include <stdint.h>
+
 #ifdef __cplusplus
 extern "C"
 {
 #endif
 
+	/* Коды возврата str2int_n и соседей */
+	enum str2int_status
+	{
+		STR2INT_OK = 0,
+		STR2INT_EMPTY,	   /* пустая строка */
+		STR2INT_INVALID,   /* нет цифр или посторонний символ */
+		STR2INT_OVERFLOW,  /* число не помещается в тип */
+		STR2INT_NO_SPACE   /* в выходном массиве не хватило места */
+	};
+
 	int str2int(const char* str);
 
+	/* Разбирают ровно len символов: необязательный знак и десятичные цифры.
+	 * Результат пишется в out только при STR2INT_OK */
+	int str2int_n(const char* str, size_t len, int* out);
+	int str2int64_n(const char* str, size_t len, int64_t* out);
+
+	/* Разбирает буфер чисел, разделенных delim (допускается завершающий
+	 * разделитель), в массив out емкостью capacity. В parsed пишется
+	 * количество разобранных чисел, при ошибке это индекс плохого поля */
+	int str2int_batch(const char* buf, size_t len, char delim, int* out,
+					  size_t capacity, size_t* parsed);
+
 #ifdef __cplusplus
 }
 #endif
@@ -1,6 +1,9 @@
 // NOLINTBEGIN
 #include <gtest/gtest.h>
 // NOLINTEND
+#include <cstdint>
+#include <random>
+#include <string>
 #include "str2int.h"
 
 TEST(str2int, BasicTest)
@@ -38,3 +41,89 @@ TEST(str2int, BasicTestDeath)
 	EXPECT_DEATH(str2int("2147483648"), "");
 	EXPECT_DEATH(str2int("214748364999"), "");
 }
+
+TEST(str2int, LengthKnown)
+{
+	int value = 0;
+	EXPECT_EQ(str2int_n("12345", 3, &value), STR2INT_OK);
+	EXPECT_EQ(value, 123);
+	EXPECT_EQ(str2int_n("-2147483648", 11, &value), STR2INT_OK);
+	EXPECT_EQ(value, INT32_MIN);
+	EXPECT_EQ(str2int_n("+000000000000002147483647", 25, &value), STR2INT_OK);
+	EXPECT_EQ(value, INT32_MAX);
+	EXPECT_EQ(str2int_n("-00", 3, &value), STR2INT_OK);
+	EXPECT_EQ(value, 0);
+}
+
+TEST(str2int, LengthKnownErrors)
+{
+	int value = 7;
+	EXPECT_EQ(str2int_n("", 0, &value), STR2INT_EMPTY);
+	EXPECT_EQ(str2int_n("-", 1, &value), STR2INT_INVALID);
+	EXPECT_EQ(str2int_n("12a4", 4, &value), STR2INT_INVALID);
+	EXPECT_EQ(str2int_n("1234567x", 8, &value), STR2INT_INVALID);
+	EXPECT_EQ(str2int_n("12345678/", 9, &value), STR2INT_INVALID);
+	EXPECT_EQ(str2int_n("2147483648", 10, &value), STR2INT_OVERFLOW);
+	EXPECT_EQ(str2int_n("-2147483649", 11, &value), STR2INT_OVERFLOW);
+	EXPECT_EQ(str2int_n("99999999999999999999999", 23, &value),
+			  STR2INT_OVERFLOW);
+	EXPECT_EQ(str2int_n("9999999999999999999999x", 23, &value),
+			  STR2INT_INVALID);
+	EXPECT_EQ(value, 7);
+}
+
+TEST(str2int, LengthKnown64)
+{
+	int64_t value = 0;
+	EXPECT_EQ(str2int64_n("-9223372036854775808", 20, &value), STR2INT_OK);
+	EXPECT_EQ(value, INT64_MIN);
+	EXPECT_EQ(str2int64_n("9223372036854775807", 19, &value), STR2INT_OK);
+	EXPECT_EQ(value, INT64_MAX);
+	EXPECT_EQ(str2int64_n("1234567890123456", 16, &value), STR2INT_OK);
+	EXPECT_EQ(value, 1234567890123456);
+	EXPECT_EQ(str2int64_n("9223372036854775808", 19, &value),
+			  STR2INT_OVERFLOW);
+	EXPECT_EQ(str2int64_n("-9223372036854775809", 20, &value),
+			  STR2INT_OVERFLOW);
+}
+
+TEST(str2int, Batch)
+{
+	const char csv[] = "1,-22,333,+4444,2147483647,\n";
+	int values[8];
+	size_t parsed = 0;
+	EXPECT_EQ(str2int_batch(csv, sizeof(csv) - 2, ',', values, 8, &parsed),
+			  STR2INT_OK);
+	ASSERT_EQ(parsed, 5u);
+	EXPECT_EQ(values[0], 1);
+	EXPECT_EQ(values[1], -22);
+	EXPECT_EQ(values[2], 333);
+	EXPECT_EQ(values[3], 4444);
+	EXPECT_EQ(values[4], 2147483647);
+
+	const char column[] = "10\n20\n30";
+	EXPECT_EQ(str2int_batch(column, sizeof(column) - 1, '\n', values, 2,
+							&parsed),
+			  STR2INT_NO_SPACE);
+	EXPECT_EQ(parsed, 2u);
+
+	const char broken[] = "10,,30";
+	EXPECT_EQ(str2int_batch(broken, sizeof(broken) - 1, ',', values, 8,
+							&parsed),
+			  STR2INT_EMPTY);
+	EXPECT_EQ(parsed, 1u);
+}
+
+TEST(str2int, RoundTrip64)
+{
+	std::mt19937_64 rng(2024);
+	for (int i = 0; i < 10000; ++i)
+	{
+		int64_t expected = static_cast<int64_t>(rng()) >> (rng() % 64);
+		std::string text = std::to_string(expected);
+		int64_t value = 0;
+		ASSERT_EQ(str2int64_n(text.data(), text.size(), &value), STR2INT_OK)
+			<< text;
+		ASSERT_EQ(value, expected);
+	}
+}